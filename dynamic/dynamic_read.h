@@ -31,6 +31,21 @@ struct kstring *kstring_append(struct kstring *a, char element);
 
 struct kstring *kstring_set(struct kstring *a, arraysize index, char element);
 
+// Make room for at least n more chars.
+struct kstring *kstring_reserve(struct kstring *a, arraysize n);
+
+struct kstring *kstring_append_u64(struct kstring *a, uint64_t value);
+
+struct kstring *kstring_append_i64(struct kstring *a, int64_t value);
+
+// Lowercase digits, without prefix and leading zeros.
+struct kstring *kstring_append_hex(struct kstring *a, uint64_t value);
+
+// The shortest decimal which reads back as the same double, formatted like
+// JavaScript does: "0.000001", "123.5" and "1e+21" or "1.5e-7" outside of
+// 1e-6 <= |value| < 1e21, and "0" for -0. Also "inf", "-inf" and "nan".
+struct kstring *kstring_append_double(struct kstring *a, double value);
+
 void kstring_free(struct kstring *a);
 
 #endif // DYNAMIC_READ
@@ -1,7 +1,22 @@
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "dynamic_read.h"
 
+// Compare and clear the string.
+static int check(struct kstring *a, const char *expected) {
+  const size_t n = strlen(expected);
+  const int ok =
+      kstring_size(a) == n && memcmp(kstring_buff(a), expected, n) == 0;
+  if (!ok)
+    printf("expected %s, got %.*s\n", expected, (int)kstring_size(a),
+           kstring_buff(a));
+  a->size = 0;
+  return !ok;
+}
+
 int main(int argc, char **args) {
   (void)argc;
   (void)args;
@@ -10,11 +25,66 @@ int main(int argc, char **args) {
   struct kstring *kstr = &str;
   kstring_from_string(kstr, "abc");
   
-  printf("%s %lu %lu\n", kstring_buff(kstr), kstring_size(kstr), kstring_reserved(kstr));
+  printf("%.*s %lu %lu\n", (int)kstring_size(kstr), kstring_buff(kstr),
+         kstring_size(kstr), kstring_reserved(kstr));
   
   kstring_append(kstr, 'd');
-  printf("%s %lu %lu\n", kstring_buff(kstr), kstring_size(kstr), kstring_reserved(kstr));
-  
+  printf("%.*s %lu %lu\n", (int)kstring_size(kstr), kstring_buff(kstr),
+         kstring_size(kstr), kstring_reserved(kstr));
+  kstring_free(kstr);
+
+  int failed = 0;
+  struct kstring num;
+  struct kstring *knum = &num;
+  kstring_init(knum, 0);
+  kstring_append_i64(knum, -9223372036854775807 - 1);
+  failed |= check(knum, "-9223372036854775808");
+  kstring_append_u64(knum, 18446744073709551615u);
+  failed |= check(knum, "18446744073709551615");
+  kstring_append_hex(knum, 0xdeadbeef);
+  failed |= check(knum, "deadbeef");
+  kstring_append_hex(knum, 0);
+  failed |= check(knum, "0");
+
+  static const struct {
+    double value;
+    const char *expected;
+  } doubles[] = {
+      {0.1, "0.1"},
+      {1e21, "1e+21"},
+      {5e-324, "5e-324"},
+      {1.7976931348623157e308, "1.7976931348623157e+308"},
+      {-0.0, "0"},
+      {1e-6, "0.000001"},
+      {1.5e-7, "1.5e-7"},
+      {123.5, "123.5"},
+      {-2.0, "-2"},
+  };
+  for (size_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); i++) {
+    kstring_append_double(knum, doubles[i].value);
+    failed |= check(knum, doubles[i].expected);
+  }
+
+  // Random bit patterns read back as the same double.
+  uint64_t state = 0x9E3779B97F4A7C15u;
+  for (int i = 0; i < 1000000; i++) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    double value;
+    memcpy(&value, &state, sizeof(value));
+    if (isnan(value) || isinf(value))
+      continue;
+    kstring_append_double(knum, value);
+    kstring_append(knum, '\0');
+    const double back = strtod(kstring_buff(knum), NULL);
+    if (memcmp(&back, &value, sizeof(value)) != 0 && value != 0) {
+      printf("%s does not read back as %a\n", kstring_buff(knum), value);
+      failed = 1;
+    }
+    knum->size = 0;
+  }
+  kstring_free(knum);
 
-  return 0;
+  return failed;
 }
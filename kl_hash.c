@@ -0,0 +1,243 @@
+#include "kl_hash.h"
+#include "kl_random.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// The odd constants of splitmix64 and xorshift64s.
+static const uint64_t secret[4] = {0x9E3779B97F4A7C15ULL,
+                                   0xBF58476D1CE4E5B9ULL,
+                                   0x94D049BB133111EBULL,
+                                   0x2545F4914F6CDD1DULL};
+
+#define BLOCK 48
+
+static inline uint64_t read64(const uint8_t *p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+static inline uint64_t read32(const uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap32(v);
+#endif
+  return v;
+}
+
+// 64x64 -> 128 bit multiplication. a receives the low half, b the high half.
+static inline void mum(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+  const __uint128_t r = (__uint128_t)*a * *b;
+  *a = (uint64_t)r;
+  *b = (uint64_t)(r >> 64);
+#else
+  const uint64_t ha = *a >> 32, hb = *b >> 32;
+  const uint64_t la = (uint32_t)*a, lb = (uint32_t)*b;
+  const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64_t t = rl + (rm0 << 32);
+  uint64_t carry = t < rl;
+  const uint64_t lo = t + (rm1 << 32);
+  carry += lo < t;
+  *a = lo;
+  *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+static inline uint64_t mix(uint64_t a, uint64_t b) {
+  mum(&a, &b);
+  return a ^ b;
+}
+
+static inline uint64_t seed_init(uint64_t seed) {
+  return seed ^ mix(seed ^ secret[0], secret[1]);
+}
+
+static inline void hash_block(const uint8_t *p, uint64_t *seed, uint64_t *see1,
+                              uint64_t *see2) {
+  *seed = mix(read64(p) ^ secret[1], read64(p + 8) ^ *seed);
+  *see1 = mix(read64(p + 16) ^ secret[2], read64(p + 24) ^ *see1);
+  *see2 = mix(read64(p + 32) ^ secret[3], read64(p + 40) ^ *see2);
+}
+
+static inline uint64_t hash_finish(uint64_t a, uint64_t b, uint64_t seed,
+                                   size_t len) {
+  a ^= secret[1];
+  b ^= seed;
+  mum(&a, &b);
+  return splitmix64_mix(mix(a ^ secret[0] ^ len, b ^ secret[1]));
+}
+
+// Input of at most 16 bytes.
+static inline uint64_t hash_short(const uint8_t *p, size_t len,
+                                  uint64_t seed) {
+  uint64_t a = 0, b = 0;
+  if (len >= 4) {
+    // Two overlapping pairs of 4 byte loads cover all 4 to 16 bytes.
+    const uint8_t *const last = p + len - 4;
+    const size_t delta = (len & 24) >> (len >> 3);
+    a = (read32(p) << 32) | read32(last);
+    b = (read32(p + delta) << 32) | read32(last - delta);
+  } else if (len > 0) {
+    a = ((uint64_t)p[0] << 56) | ((uint64_t)p[len >> 1] << 32) | p[len - 1];
+  }
+  return hash_finish(a, b, seed, len);
+}
+
+// The last 1 to 48 bytes of an input of more than 16 bytes. The 16 bytes
+// before p have to be readable if i < 16.
+static inline uint64_t hash_tail(const uint8_t *p, size_t i, uint64_t seed,
+                                 size_t len) {
+  while (i > 16) {
+    seed = mix(read64(p) ^ secret[1], read64(p + 8) ^ seed);
+    p += 16;
+    i -= 16;
+  }
+  return hash_finish(read64(p + i - 16), read64(p + i - 8), seed, len);
+}
+
+uint64_t kl_hash(const void *data, size_t len, uint64_t seed) {
+  const uint8_t *p = data;
+  seed = seed_init(seed);
+  if (len <= 16)
+    return hash_short(p, len, seed);
+
+  size_t i = len;
+  if (i > BLOCK) {
+    uint64_t see1 = seed, see2 = seed;
+    do {
+      hash_block(p, &seed, &see1, &see2);
+      p += BLOCK;
+      i -= BLOCK;
+    } while (i > BLOCK);
+    seed ^= see1 ^ see2;
+  }
+  return hash_tail(p, i, seed, len);
+}
+
+uint64_t kl_hash_str(const utf8_chr *const s, uint64_t seed) {
+  return kl_hash(s, strlen(s), seed);
+}
+
+uint64_t kl_hash_kstring(const struct kstring *const s, uint64_t seed) {
+  return kl_hash(s->buff, s->size, seed);
+}
+
+void kl_hash_init(struct kl_hash_state *const st, uint64_t seed) {
+  st->seed = st->see1 = st->see2 = seed_init(seed);
+  st->total = 0;
+  st->pending = 0;
+}
+
+void kl_hash_update(struct kl_hash_state *const st, const void *data,
+                    size_t len) {
+  const uint8_t *p = data;
+  uint8_t *const pending = st->buf + 16;
+  st->total += len;
+
+  // A block is only consumed once it is known that more input follows,
+  // because kl_hash treats the last block differently.
+  if (st->pending + len <= BLOCK) {
+    memcpy(pending + st->pending, p, len);
+    st->pending += len;
+    return;
+  }
+
+  if (st->pending > 0) {
+    const size_t n = BLOCK - st->pending;
+    memcpy(pending + st->pending, p, n);
+    p += n;
+    len -= n;
+    hash_block(pending, &st->seed, &st->see1, &st->see2);
+    memcpy(st->buf, pending + BLOCK - 16, 16);
+  }
+
+  if (len > BLOCK) {
+    do {
+      hash_block(p, &st->seed, &st->see1, &st->see2);
+      p += BLOCK;
+      len -= BLOCK;
+    } while (len > BLOCK);
+    memcpy(st->buf, p - 16, 16);
+  }
+
+  memcpy(pending, p, len);
+  st->pending = len;
+}
+
+uint64_t kl_hash_final(const struct kl_hash_state *const st) {
+  if (st->total <= 16)
+    return hash_short(st->buf + 16, st->total, st->seed);
+
+  uint64_t seed = st->seed;
+  if (st->total > BLOCK)
+    seed ^= st->see1 ^ st->see2;
+  return hash_tail(st->buf + 16, st->pending, seed, st->total);
+}
+
+// Lowercase a run of ASCII bytes into out. Returns the number of bytes
+// copied, which stops before the first non-ASCII byte.
+static size_t fold_ascii(const uint8_t *s, size_t len, uint8_t *out) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i a = _mm_set1_epi8('A' - 1);
+  const __m128i z = _mm_set1_epi8('Z' + 1);
+  const __m128i bit = _mm_set1_epi8(0x20);
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    if (_mm_movemask_epi8(v) != 0)
+      break;
+    const __m128i upper =
+        _mm_and_si128(_mm_cmpgt_epi8(v, a), _mm_cmplt_epi8(v, z));
+    _mm_storeu_si128((__m128i *)(out + i),
+                     _mm_or_si128(v, _mm_and_si128(upper, bit)));
+  }
+#endif
+  for (; i < len && s[i] < 0x80; i++)
+    out[i] = (s[i] >= 'A' && s[i] <= 'Z') ? s[i] + 0x20 : s[i];
+  return i;
+}
+
+uint64_t kl_hash_utf8_nocase(const utf8_chr *const s, size_t len,
+                             uint64_t seed) {
+  const uint8_t *const b = (const uint8_t *)s;
+  struct kl_hash_state st;
+  uint8_t out[256];
+  size_t n = 0;
+
+  kl_hash_init(&st, seed);
+  for (size_t i = 0; i < len;) {
+    // Leave room for one folded symbol after the ASCII run.
+    if (n > sizeof(out) - 4 - 16) {
+      kl_hash_update(&st, out, n);
+      n = 0;
+    }
+    const size_t room = sizeof(out) - 4 - n;
+    const size_t ascii = fold_ascii(b + i, len - i < room ? len - i : room,
+                                    out + n);
+    i += ascii;
+    n += ascii;
+    if (i == len || b[i] < 0x80)
+      continue;
+
+    utf8_code_pt c;
+    const int nbytes = utf8_decode_next(s + i, len - i, &c);
+    if (nbytes < 1) {
+      out[n++] = b[i++];
+      continue;
+    }
+    n += utf8_from_codepoint(utf8_casefold_codepoint(c),
+                             (utf8_chr *)out + n);
+    i += nbytes;
+  }
+  kl_hash_update(&st, out, n);
+  return kl_hash_final(&st);
+}
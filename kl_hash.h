@@ -0,0 +1,64 @@
+#ifndef KL_HASH_H
+#define KL_HASH_H
+
+#include "dynamic/dynamic_read.h"
+#include "utf8.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fast non-cryptographic 64 bit hashes for keys of any length. The bulk of
+// the input is consumed in 48 byte blocks using three independent 128 bit
+// multiply-xor lanes, the rest in 16 and 8 byte loads. The result is
+// finished with the splitmix64 mixer from kl_random.h.
+// The result does not depend on the endianness of the machine.
+// Not suitable against hash flooding by an attacker who knows the seed.
+
+uint64_t kl_hash(const void *data, size_t len, uint64_t seed);
+
+// Hash of a 0-terminated string, without the terminator.
+uint64_t kl_hash_str(const utf8_chr *const s, uint64_t seed);
+
+uint64_t kl_hash_kstring(const struct kstring *const s, uint64_t seed);
+
+// Case insensitive hash. Strings which are equal after simple case folding
+// (see utf8_casefold_codepoint) have the same hash. The result is the same
+// as kl_hash of the folded string.
+// Invalid bytes are hashed as they are and do not set utf8_lib_error.
+uint64_t kl_hash_utf8_nocase(const utf8_chr *const s, size_t len,
+                             uint64_t seed);
+
+// Streaming hash for input which arrives in chunks. The result is the same
+// as kl_hash of all chunks put together, no matter how the input is split.
+//   struct kl_hash_state st;
+//   kl_hash_init(&st, seed);
+//   kl_hash_update(&st, chunk1, len1);
+//   kl_hash_update(&st, chunk2, len2);
+//   uint64_t h = kl_hash_final(&st);
+struct kl_hash_state {
+  uint64_t seed;
+  uint64_t see1;
+  uint64_t see2;
+  size_t total;
+  // The last 16 bytes of the previous block, followed by up to 48 bytes
+  // which were not consumed yet.
+  uint8_t buf[64];
+  size_t pending;
+};
+
+void kl_hash_init(struct kl_hash_state *const st, uint64_t seed);
+
+void kl_hash_update(struct kl_hash_state *const st, const void *data,
+                    size_t len);
+
+// Does not change the state, so more input can be added afterwards.
+uint64_t kl_hash_final(const struct kl_hash_state *const st);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_HASH_H
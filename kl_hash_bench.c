@@ -0,0 +1,107 @@
+// Throughput and avalanche benchmarks for kl_hash.
+// Build with optimizations, for example
+//   cc -O2 utf8.c kl_random.c kl_hash.c dynamic/dynamic_read.c kl_hash_bench.c
+
+#include "kl_hash.h"
+#include "kl_random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+static void fill(uint8_t *buf, size_t len) {
+  for (size_t i = 0; i < len; i++)
+    buf[i] = (uint8_t)xorshift64s_E();
+}
+
+// Hash keys of a fixed size over and over. Each hash depends on the previous
+// one, so the latency of short keys is measured as well.
+static void throughput(const uint8_t *buf, size_t size) {
+  const size_t total = (size_t)1 << 30;
+  const size_t rounds = total / size;
+  uint64_t h = 0;
+  const double start = now();
+  for (size_t i = 0; i < rounds; i++)
+    h = kl_hash(buf, size, h);
+  const double t = now() - start;
+  printf("%9zu bytes: %8.2f GB/s %8.2f ns/hash (%016llx)\n", size,
+         (double)(rounds * size) / t * 1e-9, t / rounds * 1e9,
+         (unsigned long long)h);
+}
+
+static void throughput_stream(const uint8_t *buf, size_t size, size_t chunk) {
+  const size_t total = (size_t)1 << 30;
+  const size_t rounds = total / size;
+  struct kl_hash_state st;
+  uint64_t h = 0;
+  const double start = now();
+  for (size_t i = 0; i < rounds; i++) {
+    kl_hash_init(&st, h);
+    for (size_t j = 0; j < size; j += chunk)
+      kl_hash_update(&st, buf + j, size - j < chunk ? size - j : chunk);
+    h = kl_hash_final(&st);
+  }
+  const double t = now() - start;
+  printf("%9zu bytes in chunks of %zu: %8.2f GB/s (%016llx)\n", size, chunk,
+         (double)(rounds * size) / t * 1e-9, (unsigned long long)h);
+}
+
+// Flip every input bit of random keys and count how often every output bit
+// changes. Ideally each one changes with a probability of 0.5. Prints the
+// largest deviation from that.
+static void avalanche(size_t size, size_t keys) {
+  uint8_t buf[256];
+  double worst = 0;
+  unsigned long long *counts = calloc(size * 8 * 64, sizeof(*counts));
+  if (!counts)
+    return;
+
+  for (size_t k = 0; k < keys; k++) {
+    fill(buf, size);
+    const uint64_t seed = xorshift64s_E();
+    const uint64_t h = kl_hash(buf, size, seed);
+    for (size_t bit = 0; bit < size * 8; bit++) {
+      buf[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+      const uint64_t diff = h ^ kl_hash(buf, size, seed);
+      buf[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+      for (int out = 0; out < 64; out++)
+        counts[bit * 64 + out] += (diff >> out) & 1;
+    }
+  }
+
+  for (size_t i = 0; i < size * 8 * 64; i++) {
+    const double bias = (double)counts[i] / keys - 0.5;
+    const double abs_bias = bias < 0 ? -bias : bias;
+    if (abs_bias > worst)
+      worst = abs_bias;
+  }
+  printf("%9zu bytes: worst bias %.4f over %zu keys\n", size, worst, keys);
+  free(counts);
+}
+
+int main(void) {
+  const size_t max = (size_t)1 << 20;
+  uint8_t *buf = malloc(max);
+  if (!buf)
+    return 1;
+  random_init(0);
+  fill(buf, max);
+
+  puts("Throughput");
+  const size_t sizes[] = {4, 8, 16, 32, 64, 256, 1024, 4096, 65536, max};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    throughput(buf, sizes[i]);
+  throughput_stream(buf, max, 1);
+  throughput_stream(buf, max, 100);
+  throughput_stream(buf, max, 4096);
+
+  puts("Avalanche");
+  const size_t avalanche_sizes[] = {1, 3, 4, 8, 12, 16, 17, 32, 48, 49, 100};
+  for (size_t i = 0; i < sizeof(avalanche_sizes) / sizeof(size_t); i++)
+    avalanche(avalanche_sizes[i], 20000);
+
+  free(buf);
+  return 0;
+}
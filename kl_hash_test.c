@@ -0,0 +1,115 @@
+#include "kl_hash.h"
+#include "utest/utest.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+static void fill(uint8_t *buf, size_t len) {
+  unsigned seed = 7;
+  for (size_t i = 0; i < len; i++) {
+    seed = seed * 1103515245 + 12345;
+    buf[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+UTEST(kl_hash, deterministic) {
+  const char *s = "The quick brown fox jumps over the lazy dog";
+  ASSERT_EQ(kl_hash(s, strlen(s), 0), kl_hash(s, strlen(s), 0));
+  ASSERT_EQ(kl_hash_str(U8(s), 1), kl_hash(s, strlen(s), 1));
+  ASSERT_NE(kl_hash(s, strlen(s), 0), kl_hash(s, strlen(s), 1));
+  ASSERT_NE(kl_hash(s, strlen(s), 0), kl_hash(s, strlen(s) - 1, 0));
+  ASSERT_NE(kl_hash("", 0, 0), kl_hash("\0", 1, 0));
+}
+
+UTEST(kl_hash, kstring) {
+  struct kstring k;
+  ASSERT_TRUE(kstring_from_string(&k, "abc") != NULL);
+  ASSERT_EQ(kl_hash_kstring(&k, 5), kl_hash("abc", 3, 5));
+  kstring_free(&k);
+}
+
+UTEST(kl_hash, all_lengths_differ) {
+  // Every length up to a few blocks, so that all paths are taken.
+  uint8_t buf[200];
+  uint64_t hashes[sizeof(buf) + 1];
+  fill(buf, sizeof(buf));
+  for (size_t len = 0; len <= sizeof(buf); len++) {
+    hashes[len] = kl_hash(buf, len, 0);
+    for (size_t j = 0; j < len; j++)
+      ASSERT_NE(hashes[j], hashes[len]);
+  }
+}
+
+UTEST(kl_hash, streaming) {
+  uint8_t buf[300];
+  fill(buf, sizeof(buf));
+  for (size_t len = 0; len <= sizeof(buf); len += 7) {
+    const uint64_t expected = kl_hash(buf, len, 42);
+    for (size_t step = 1; step <= 100; step++) {
+      struct kl_hash_state st;
+      kl_hash_init(&st, 42);
+      for (size_t i = 0; i < len; i += step)
+        kl_hash_update(&st, buf + i, len - i < step ? len - i : step);
+      ASSERT_EQ(kl_hash_final(&st), expected);
+    }
+  }
+}
+
+UTEST(kl_hash, streaming_split) {
+  uint8_t buf[150];
+  fill(buf, sizeof(buf));
+  const uint64_t expected = kl_hash(buf, sizeof(buf), 3);
+  for (size_t a = 0; a <= sizeof(buf); a++) {
+    for (size_t b = a; b <= sizeof(buf); b += 5) {
+      struct kl_hash_state st;
+      kl_hash_init(&st, 3);
+      kl_hash_update(&st, buf, a);
+      kl_hash_update(&st, buf + a, b - a);
+      kl_hash_update(&st, buf + b, sizeof(buf) - b);
+      ASSERT_EQ(kl_hash_final(&st), expected);
+    }
+  }
+}
+
+UTEST(kl_hash, nocase) {
+  const char *a = "Stra\xC3\x9F" "E \xCE\x9B\xCE\xA3 \xE1\xBA\x9E \xE2\x84\xAA";
+  const char *b = "strA\xC3\x9F" "e \xCE\xBB\xCF\x82 \xC3\x9F k";
+  const char *folded = "stra\xC3\x9F" "e \xCE\xBB\xCF\x83 \xC3\x9F k";
+  ASSERT_EQ(kl_hash_utf8_nocase(U8(a), strlen(a), 9),
+            kl_hash_utf8_nocase(U8(b), strlen(b), 9));
+  ASSERT_EQ(kl_hash_utf8_nocase(U8(a), strlen(a), 9),
+            kl_hash(folded, strlen(folded), 9));
+  ASSERT_NE(kl_hash_utf8_nocase(U8(a), strlen(a), 9),
+            kl_hash_utf8_nocase(U8("strasse"), 7, 9));
+
+  // Invalid bytes are hashed as they are.
+  ASSERT_EQ(kl_hash_utf8_nocase(U8("A\xFF" "B"), 3, 0),
+            kl_hash("a\xFF" "b", 3, 0));
+  // So are sequences which decode above U+10FFFF.
+  set_utf8_lib_error(0);
+  ASSERT_EQ(kl_hash_utf8_nocase(U8("\xF5\x80\x80\x80" "ABC"), 7, 0),
+            kl_hash("\xF5\x80\x80\x80" "abc", 7, 0));
+  ASSERT_EQ(get_utf8_lib_error(), 0);
+}
+
+UTEST(kl_hash, nocase_long) {
+  // Longer than the internal buffer, mixing ASCII and other symbols.
+  char upper[3000], lower[3000];
+  size_t len = 0;
+  for (int i = 0; len + 3 < sizeof(upper); i++) {
+    if (i % 7 == 0) {
+      memcpy(upper + len, "\xD0\x96", 2); // Ж
+      memcpy(lower + len, "\xD0\xB6", 2); // ж
+      len += 2;
+    } else {
+      upper[len] = (char)('A' + i % 26);
+      lower[len] = (char)('a' + i % 26);
+      len++;
+    }
+  }
+  ASSERT_EQ(kl_hash_utf8_nocase(U8(upper), len, 1), kl_hash(lower, len, 1));
+  ASSERT_EQ(kl_hash_utf8_nocase(U8(lower), len, 1), kl_hash(lower, len, 1));
+}
+
+UTEST_MAIN()
@@ -1,11 +1,27 @@
 #include "kl_random.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-uint32_t xorshift32_state_global;
-uint64_t xorshift64_state_global;
-struct xorshift128_state xorshift128_state_global;
-uint64_t xorshift64s_state_global;
-uint64_t splitmix64_state_global;
+#include <stdatomic.h>
+
+// States of the *_E functions of a thread. generation is the value of
+// random_generation they were seeded with, 0 if they were never seeded.
+struct random_states {
+  uint64_t generation;
+  uint32_t xorshift32;
+  uint64_t xorshift64;
+  struct xorshift128_state xorshift128;
+  uint64_t xorshift64s;
+  uint64_t splitmix64;
+};
+
+static _Thread_local struct random_states thread_states;
+
+// Every random_init starts a new generation, so that all threads reseed.
+static _Atomic uint64_t random_seed = 0;
+static _Atomic uint64_t random_generation = 1;
+static _Atomic uint64_t random_next_stream = 0;
 
 uint32_t xorshift32(uint32_t *state) {
   uint32_t x = *state;
@@ -59,41 +75,313 @@ uint64_t xorshift64s(uint64_t *state) {
 }
 
 uint64_t splitmix64(uint64_t *state) {
-  uint64_t result = (*state += 0x9E3779B97f4A7C15ULL);
-  result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
-  result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
-  result = result ^ (result >> 31);
+  uint64_t result = splitmix64_mix(*state += 0x9E3779B97f4A7C15ULL);
   *state = result;
   return result;
 }
 
-void random_init(uint64_t seed) {
+// Every generator is a chain of dependent steps, so unrolling cannot
+// overlap them. It does save the loop overhead, and the copies of the state
+// are locals, so the calls are inlined and the state stays in registers
+// instead of being stored and reloaded for every value.
+#define FILL_UNROLLED(buf, n, next)                                            \
+  do {                                                                         \
+    size_t i = 0;                                                              \
+    for (; i + 4 <= (n); i += 4) {                                             \
+      (buf)[i] = next;                                                         \
+      (buf)[i + 1] = next;                                                     \
+      (buf)[i + 2] = next;                                                     \
+      (buf)[i + 3] = next;                                                     \
+    }                                                                          \
+    for (; i < (n); i++)                                                       \
+      (buf)[i] = next;                                                         \
+  } while (0)
+
+void xorshift32_fill(uint32_t *state, uint32_t *buf, size_t n) {
+  uint32_t x = *state;
+  FILL_UNROLLED(buf, n, xorshift32(&x));
+  *state = x;
+}
+
+void xorshift64_fill(uint64_t *state, uint64_t *buf, size_t n) {
+  uint64_t x = *state;
+  FILL_UNROLLED(buf, n, xorshift64(&x));
+  *state = x;
+}
+
+void xorshift128_fill(struct xorshift128_state *state, uint32_t *buf,
+                      size_t n) {
+  struct xorshift128_state x = *state;
+  FILL_UNROLLED(buf, n, xorshift128(&x));
+  *state = x;
+}
+
+void xorshift64s_fill(uint64_t *state, uint64_t *buf, size_t n) {
+  uint64_t x = *state;
+  FILL_UNROLLED(buf, n, xorshift64s(&x));
+  *state = x;
+}
+
+void splitmix64_fill(uint64_t *state, uint64_t *buf, size_t n) {
+  uint64_t x = *state;
+  FILL_UNROLLED(buf, n, splitmix64(&x));
+  *state = x;
+}
+
+#undef FILL_UNROLLED
+
+void xorshift64s_lanes_init(struct xorshift64s_lanes *lanes, uint64_t seed) {
+  for (int i = 0; i < XORSHIFT64S_LANES; i++) {
+    // xorshift never leaves a state of 0.
+    do
+      lanes->s[i] = splitmix64(&seed);
+    while (lanes->s[i] == 0);
+  }
+}
+
+// Implementations of xorshift64s_lanes_fill for whole rounds of 8 values.
+typedef void (*lanes_fill_fn)(uint64_t *s, uint64_t *buf, size_t rounds);
+
+static void lanes_fill_generic(uint64_t *s, uint64_t *buf, size_t rounds) {
+  for (size_t r = 0; r < rounds; r++, buf += XORSHIFT64S_LANES)
+    for (int i = 0; i < XORSHIFT64S_LANES; i++)
+      buf[i] = xorshift64s(&s[i]);
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+
+// Neither SSE nor AVX2 multiplies 64 bit numbers, so the low 64 bits of the
+// product are put together from 32 bit products. The high halves multiply
+// each other only above bit 64.
+__attribute__((target("avx2"))) static inline __m256i
+mul_avx2(__m256i x, __m256i m, __m256i m_high) {
+  const __m256i cross =
+      _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), m),
+                       _mm256_mul_epu32(x, m_high));
+  return _mm256_add_epi64(_mm256_mul_epu32(x, m),
+                          _mm256_slli_epi64(cross, 32));
+}
+
+__attribute__((target("avx2"))) static inline __m256i
+step_avx2(__m256i x, __m256i m, __m256i m_high) {
+  x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 12));
+  x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 25));
+  x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 27));
+  return mul_avx2(x, m, m_high);
+}
+
+__attribute__((target("avx2"))) static void
+lanes_fill_avx2(uint64_t *s, uint64_t *buf, size_t rounds) {
+  const __m256i m = _mm256_set1_epi64x(0x2545F4914F6CDD1DLL);
+  const __m256i m_high = _mm256_srli_epi64(m, 32);
+  __m256i lo = _mm256_loadu_si256((const __m256i *)s);
+  __m256i hi = _mm256_loadu_si256((const __m256i *)(s + 4));
+  for (size_t r = 0; r < rounds; r++, buf += XORSHIFT64S_LANES) {
+    lo = step_avx2(lo, m, m_high);
+    hi = step_avx2(hi, m, m_high);
+    _mm256_storeu_si256((__m256i *)buf, lo);
+    _mm256_storeu_si256((__m256i *)(buf + 4), hi);
+  }
+  _mm256_storeu_si256((__m256i *)s, lo);
+  _mm256_storeu_si256((__m256i *)(s + 4), hi);
+}
+
+__attribute__((target("avx512f,avx512dq"))) static void
+lanes_fill_avx512(uint64_t *s, uint64_t *buf, size_t rounds) {
+  const __m512i m = _mm512_set1_epi64(0x2545F4914F6CDD1DLL);
+  __m512i x = _mm512_loadu_si512(s);
+  for (size_t r = 0; r < rounds; r++, buf += XORSHIFT64S_LANES) {
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 12));
+    x = _mm512_xor_si512(x, _mm512_slli_epi64(x, 25));
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 27));
+    x = _mm512_mullo_epi64(x, m);
+    _mm512_storeu_si512(buf, x);
+  }
+  _mm512_storeu_si512(s, x);
+}
+#endif
+
+static lanes_fill_fn select_lanes_fill(void) {
+#if defined(__GNUC__) && defined(__x86_64__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+    return lanes_fill_avx512;
+  if (__builtin_cpu_supports("avx2"))
+    return lanes_fill_avx2;
+#endif
+  return lanes_fill_generic;
+}
+
+void xorshift64s_lanes_fill(struct xorshift64s_lanes *lanes, uint64_t *buf,
+                            size_t n) {
+  static _Atomic(lanes_fill_fn) selected = NULL;
+  lanes_fill_fn fill = atomic_load_explicit(&selected, memory_order_relaxed);
+  if (!fill) {
+    fill = select_lanes_fill();
+    atomic_store_explicit(&selected, fill, memory_order_relaxed);
+  }
+
+  fill(lanes->s, buf, n / XORSHIFT64S_LANES);
+  const size_t rest = n % XORSHIFT64S_LANES;
+  if (rest > 0) {
+    uint64_t last[XORSHIFT64S_LANES];
+    lanes_fill_generic(lanes->s, last, 1);
+    for (size_t i = 0; i < rest; i++)
+      buf[n - rest + i] = last[i];
+  }
+}
+
+// Jumps. A step of xorshift is a linear map T on the bits of the state, so
+// n steps are T^n. T^n equals r(T) for the remainder r of x^n divided by the
+// characteristic polynomial of T, so the state after n steps is the sum of
+// the states after i steps for the terms x^i of r, with i below the size of
+// the state.
+
+// A polynomial over GF(2) of degree below 128. Bit i is the term x^i.
+struct gf2_poly {
+  uint64_t w[2];
+};
+
+// Characteristic polynomials without their leading term x^bits, found with
+// the Berlekamp-Massey algorithm.
+static const struct gf2_poly xorshift32_poly = {{0x3EC241, 0}};
+static const struct gf2_poly xorshift64_poly = {{0x013ED4A358913201, 0}};
+static const struct gf2_poly xorshift128_poly = {
+    {0xF985D65FFD3C8001, 0x10046D8B3}};
+
+static inline bool gf2_bit(const struct gf2_poly *a, int i) {
+  return (a->w[i / 64] >> (i % 64)) & 1;
+}
+
+// a * x modulo x^bits + p.
+static inline void gf2_times_x(struct gf2_poly *a, const struct gf2_poly *p,
+                               int bits) {
+  const bool carry = gf2_bit(a, bits - 1);
+  a->w[1] = (a->w[1] << 1) | (a->w[0] >> 63);
+  a->w[0] <<= 1;
+  if (bits < 128)
+    a->w[bits / 64] &= ((uint64_t)1 << (bits % 64)) - 1;
+  if (carry) {
+    a->w[0] ^= p->w[0];
+    a->w[1] ^= p->w[1];
+  }
+}
+
+// a * b modulo x^bits + p, by Horner's rule over the terms of b.
+static struct gf2_poly gf2_mul(const struct gf2_poly *a,
+                               const struct gf2_poly *b,
+                               const struct gf2_poly *p, int bits) {
+  struct gf2_poly r = {{0, 0}};
+  for (int i = bits - 1; i >= 0; i--) {
+    gf2_times_x(&r, p, bits);
+    if (gf2_bit(b, i)) {
+      r.w[0] ^= a->w[0];
+      r.w[1] ^= a->w[1];
+    }
+  }
+  return r;
+}
+
+// x^n modulo x^bits + p.
+static struct gf2_poly jump_poly(uint64_t n, const struct gf2_poly *p,
+                                 int bits) {
+  struct gf2_poly r = {{1, 0}};
+  for (int i = 63; i >= 0; i--) {
+    r = gf2_mul(&r, &r, p, bits);
+    if ((n >> i) & 1)
+      gf2_times_x(&r, p, bits);
+  }
+  return r;
+}
+
+void xorshift32_jump(uint32_t *state, uint64_t n) {
+  const struct gf2_poly r = jump_poly(n, &xorshift32_poly, 32);
+  uint32_t x = *state;
+  uint32_t sum = 0;
+  for (int i = 0; i < 32; i++, xorshift32(&x))
+    if (gf2_bit(&r, i))
+      sum ^= x;
+  *state = sum;
+}
+
+void xorshift64_jump(uint64_t *state, uint64_t n) {
+  const struct gf2_poly r = jump_poly(n, &xorshift64_poly, 64);
+  uint64_t x = *state;
+  uint64_t sum = 0;
+  for (int i = 0; i < 64; i++, xorshift64(&x))
+    if (gf2_bit(&r, i))
+      sum ^= x;
+  *state = sum;
+}
+
+void xorshift128_jump(struct xorshift128_state *state, uint64_t n) {
+  const struct gf2_poly r = jump_poly(n, &xorshift128_poly, 128);
+  struct xorshift128_state x = *state;
+  struct xorshift128_state sum = {{0, 0, 0, 0}};
+  for (int i = 0; i < 128; i++, xorshift128(&x))
+    if (gf2_bit(&r, i))
+      for (int j = 0; j < 4; j++)
+        sum.x[j] ^= x.x[j];
+  *state = sum;
+}
+
+static void seed_states(struct random_states *states, uint64_t seed) {
   if (seed == 0) {
-    xorshift32_state_global = 0xF1A6;
-    xorshift64_state_global = 0xDEAD10CC;
-    xorshift128_state_init_64(&xorshift128_state_global, 0xBADDCAFE,
-                              0xDEADDEAD);
-    xorshift64s_state_global = 0xDEADBEEF;
-    splitmix64_state_global = 0xFEE1DEAD;
+    states->xorshift32 = 0xF1A6;
+    states->xorshift64 = 0xDEAD10CC;
+    xorshift128_state_init_64(&states->xorshift128, 0xBADDCAFE, 0xDEADDEAD);
+    states->xorshift64s = 0xDEADBEEF;
+    states->splitmix64 = 0xFEE1DEAD;
   } else {
-    xorshift32_state_global = seed & 0xFFFF;
-    xorshift64_state_global = seed;
+    // xorshift32 would only return 0 from a state of 0.
+    states->xorshift32 = seed & 0xFFFF ? seed & 0xFFFF : 0xF1A6;
+    states->xorshift64 = seed;
     uint64_t temp = seed;
-    xorshift128_state_init_64(&xorshift128_state_global, splitmix64(&temp),
-                              seed);
-    xorshift64s_state_global = seed;
-    splitmix64_state_global = seed;
+    xorshift128_state_init_64(&states->xorshift128, splitmix64(&temp), seed);
+    states->xorshift64s = seed;
+    states->splitmix64 = seed;
   }
 }
 
-// Defines a global version of a compatible algorithm.
+// Stream 0 is the seed itself, so a single thread gets the same values as
+// before there were streams.
+static void seed_stream(struct random_states *states, uint64_t stream) {
+  uint64_t seed = atomic_load(&random_seed);
+  if (stream != 0)
+    seed = splitmix64_mix(seed + stream * 0x9E3779B97F4A7C15ULL);
+  seed_states(states, seed);
+  states->generation = atomic_load(&random_generation);
+}
+
+void random_init(uint64_t seed) {
+  atomic_store(&random_seed, seed);
+  atomic_store(&random_next_stream, 1);
+  atomic_fetch_add(&random_generation, 1);
+  seed_stream(&thread_states, 0);
+}
+
+void random_init_thread(uint64_t stream) {
+  seed_stream(&thread_states, stream);
+}
+
+static inline struct random_states *get_thread_states(void) {
+  struct random_states *states = &thread_states;
+  if (states->generation != atomic_load_explicit(&random_generation,
+                                                 memory_order_relaxed))
+    seed_stream(states, atomic_fetch_add(&random_next_stream, 1));
+  return states;
+}
+
+// Defines a global version of a compatible algorithm, which uses the state
+// of the calling thread.
 // For example,
 //      DEFINE_INPLACE_RANDOM_KL_ALGORITHM(uint64_t, xorshift64s)
 // will create
 //      uint64_t xorshift64s_E(void);
 // Luckily, this macro is undefined after use.
 #define DEFINE_INPLACE_RANDOM_KL_ALGORITHM(type, name)                         \
-  type name##_E(void) { return name(&name##_state_global); }
+  type name##_E(void) { return name(&get_thread_states()->name); }
 
 DEFINE_INPLACE_RANDOM_KL_ALGORITHM(uint32_t, xorshift32)
 DEFINE_INPLACE_RANDOM_KL_ALGORITHM(uint64_t, xorshift64)
@@ -1,6 +1,7 @@
 
 #ifndef KL_RAND_H
 #define KL_RAND_H
+#include <stddef.h>
 #include <stdint.h>
 
 struct xorshift128_state {
@@ -13,16 +14,73 @@ uint64_t xorshift64(uint64_t *state);
 
 uint32_t xorshift128(struct xorshift128_state *state);
 
-static struct xorshift128_state *
-xorshift128_state_init_64(struct xorshift128_state *state, uint64_t upper_seed,
-                          uint64_t lower_seed);
-
 uint64_t xorshift64s(uint64_t *state);
 
 uint64_t splitmix64(uint64_t *state);
 
+// Fill buf with the next n values of a generator, the same ones n calls
+// would return. The state stays in registers until the end.
+void xorshift32_fill(uint32_t *state, uint32_t *buf, size_t n);
+void xorshift64_fill(uint64_t *state, uint64_t *buf, size_t n);
+void xorshift128_fill(struct xorshift128_state *state, uint32_t *buf,
+                      size_t n);
+void xorshift64s_fill(uint64_t *state, uint64_t *buf, size_t n);
+void splitmix64_fill(uint64_t *state, uint64_t *buf, size_t n);
+
+// Eight xorshift64s generators which run side by side, so that they fill
+// SIMD registers. Lane i on its own returns exactly what xorshift64s does
+// with s[i] as its state.
+#define XORSHIFT64S_LANES 8
+
+struct xorshift64s_lanes {
+  uint64_t s[XORSHIFT64S_LANES];
+};
+
+// Seed the lanes with successive values of splitmix64, starting at seed.
+void xorshift64s_lanes_init(struct xorshift64s_lanes *lanes, uint64_t seed);
+
+// Fill buf with n values, a value of every lane in turn: buf[j * 8 + i] is
+// value j of lane i. If n is not a multiple of 8, the values of the last
+// round which do not fit are dropped. Runs with AVX-512 or AVX2 if the CPU
+// has them, with the same results.
+void xorshift64s_lanes_fill(struct xorshift64s_lanes *lanes, uint64_t *buf,
+                            size_t n);
+
+// Advance a state as far as n calls would, in O(log n) steps. Handing
+// jumps of n, 2n, 3n, ... to workers gives each of them n values of one
+// sequence which no other worker gets. xorshift64s multiplies its state,
+// which breaks the linearity these jumps need, so it has none.
+void xorshift32_jump(uint32_t *state, uint64_t n);
+void xorshift64_jump(uint64_t *state, uint64_t n);
+void xorshift128_jump(struct xorshift128_state *state, uint64_t n);
+
+// The finalizer of splitmix64. Every input bit affects every output bit and
+// the function is a bijection, so it is also useful for hashing.
+static inline uint64_t splitmix64_mix(uint64_t x) {
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+// Value i of the usual SplitMix64 sequence, which mixes a counter, starting
+// at seed. Unlike splitmix64, which feeds its results back into its state,
+// any value of it can be had in O(1).
+static inline uint64_t splitmix64_at(uint64_t seed, uint64_t i) {
+  return splitmix64_mix(seed + (i + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+// The *_E functions use a state of their own in every thread, so they are
+// thread safe and threads do not slow each other down.
+// random_init sets the seed of all threads and seeds the calling thread with
+// stream 0 of it. Each other thread is seeded on its first call with the
+// next stream, derived from the seed with splitmix64. Without random_init,
+// the seed is 0. random_init must not run while other threads generate.
 void random_init(uint64_t seed);
 
+// Seed the calling thread with the given stream of the current seed. The
+// streams of threads are only reproducible if they are chosen this way.
+void random_init_thread(uint64_t stream);
+
 uint32_t xorshift32_E();
 uint64_t xorshift64_E();
 uint64_t xorshift64s_E();
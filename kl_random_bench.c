@@ -0,0 +1,75 @@
+// Throughput of the kl_random generators, one call per value against the
+// *_fill functions, and of the lanes of xorshift64s against its *_fill.
+// Build with optimizations, for example
+//   cc -O2 kl_random.c kl_random_bench.c
+
+#include "kl_random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+// Bytes generated per measurement and the size of the buffer, which fits
+// into the L2 cache of most machines.
+#define TOTAL ((size_t)1 << 30)
+#define BUFFER ((size_t)1 << 18)
+
+static void report(const char *name, double loop, double fill,
+                   unsigned long long check) {
+  printf("%-12s loop %6.2f GB/s  fill %6.2f GB/s  %5.2fx (%016llx)\n", name,
+         TOTAL / loop * 1e-9, TOTAL / fill * 1e-9, loop / fill, check);
+}
+
+// Generate TOTAL bytes into buf with a call per value, then with the fill
+// function, starting from the same state.
+#define BENCH(name, type, state_type, init)                                    \
+  do {                                                                         \
+    type *buf = (type *)bytes;                                                 \
+    const size_t n = BUFFER / sizeof(type);                                    \
+    state_type state = init;                                                   \
+    double start = now();                                                      \
+    for (size_t r = 0; r < TOTAL / BUFFER; r++)                                \
+      for (size_t i = 0; i < n; i++)                                           \
+        buf[i] = name(&state);                                                 \
+    const double loop = now() - start;                                         \
+    const unsigned long long check = buf[n - 1];                               \
+    state = init;                                                              \
+    start = now();                                                             \
+    for (size_t r = 0; r < TOTAL / BUFFER; r++)                                \
+      name##_fill(&state, buf, n);                                             \
+    const double fill = now() - start;                                         \
+    if (buf[n - 1] != check)                                                   \
+      printf("%s: fill differs from the loop\n", #name);                      \
+    report(#name, loop, fill, check);                                          \
+  } while (0)
+
+int main(void) {
+  void *bytes = malloc(BUFFER);
+  if (!bytes)
+    return 1;
+  BENCH(xorshift32, uint32_t, uint32_t, 0xF1A6);
+  BENCH(xorshift64, uint64_t, uint64_t, 0xDEAD10CC);
+  BENCH(xorshift128, uint32_t, struct xorshift128_state,
+        ((struct xorshift128_state){{0xCAFE, 0xBADD0000, 0xDEAD, 0xDEAD0000}}));
+  BENCH(xorshift64s, uint64_t, uint64_t, 0xDEADBEEF);
+  BENCH(splitmix64, uint64_t, uint64_t, 0xFEE1DEAD);
+
+  // Eight generators at once against one at a time.
+  const size_t n = BUFFER / sizeof(uint64_t);
+  struct xorshift64s_lanes lanes;
+  xorshift64s_lanes_init(&lanes, 1);
+  double start = now();
+  for (size_t r = 0; r < TOTAL / BUFFER; r++)
+    xorshift64s_fill(&lanes.s[0], bytes, n);
+  const double single = now() - start;
+  start = now();
+  for (size_t r = 0; r < TOTAL / BUFFER; r++)
+    xorshift64s_lanes_fill(&lanes, bytes, n);
+  const double multi = now() - start;
+  report("64s lanes", single, multi, ((uint64_t *)bytes)[n - 1]);
+
+  free(bytes);
+  return 0;
+}
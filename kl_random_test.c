@@ -0,0 +1,214 @@
+#include "kl_random.h"
+#include "utest/utest.h"
+
+#include <pthread.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: *_fill                                                  //
+//////////////////////////////////////////////////////////////////////
+
+// Fill with several lengths, so the unrolled part and the rest are both
+// used, and compare with one call per value from the same state.
+#define FILL_MATCHES_CALLS(name, type, state_type, init)                       \
+  do {                                                                         \
+    for (size_t n = 0; n < 40; n++) {                                          \
+      type buf[40];                                                            \
+      state_type a = init;                                                     \
+      state_type b = init;                                                     \
+      name##_fill(&a, buf, n);                                                 \
+      for (size_t i = 0; i < n; i++)                                           \
+        ASSERT_EQ(buf[i], name(&b));                                           \
+      ASSERT_EQ(name(&a), name(&b));                                           \
+    }                                                                          \
+  } while (0)
+
+UTEST(random_fill, xorshift32) {
+  FILL_MATCHES_CALLS(xorshift32, uint32_t, uint32_t, 0xF1A6);
+}
+
+UTEST(random_fill, xorshift64) {
+  FILL_MATCHES_CALLS(xorshift64, uint64_t, uint64_t, 0xDEAD10CC);
+}
+
+UTEST(random_fill, xorshift128) {
+  const struct xorshift128_state init = {{1, 2, 3, 4}};
+  FILL_MATCHES_CALLS(xorshift128, uint32_t, struct xorshift128_state, init);
+}
+
+UTEST(random_fill, xorshift64s) {
+  FILL_MATCHES_CALLS(xorshift64s, uint64_t, uint64_t, 0xDEADBEEF);
+}
+
+UTEST(random_fill, splitmix64) {
+  FILL_MATCHES_CALLS(splitmix64, uint64_t, uint64_t, 0xFEE1DEAD);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: xorshift64s_lanes                                       //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(xorshift64s_lanes, init) {
+  struct xorshift64s_lanes lanes;
+  xorshift64s_lanes_init(&lanes, 42);
+  uint64_t seed = 42;
+  for (int i = 0; i < XORSHIFT64S_LANES; i++)
+    ASSERT_EQ(lanes.s[i], splitmix64(&seed));
+}
+
+// Every lane gives the values of the scalar generator, whichever
+// implementation runs on this machine.
+UTEST(xorshift64s_lanes, same_as_scalar) {
+  enum { ROUNDS = 100 };
+  uint64_t buf[ROUNDS * XORSHIFT64S_LANES + 3];
+  for (size_t n = 0; n < 20; n++) {
+    struct xorshift64s_lanes lanes;
+    xorshift64s_lanes_init(&lanes, n);
+    struct xorshift64s_lanes scalar = lanes;
+    const size_t total = ROUNDS * XORSHIFT64S_LANES + n % 4;
+    xorshift64s_lanes_fill(&lanes, buf, total);
+    for (size_t j = 0; j < total; j++) {
+      uint64_t *const lane = &scalar.s[j % XORSHIFT64S_LANES];
+      ASSERT_EQ(buf[j], xorshift64s(lane));
+    }
+    // The rest of a partial round is dropped.
+    for (size_t i = total % XORSHIFT64S_LANES;
+         total % XORSHIFT64S_LANES != 0 && i < XORSHIFT64S_LANES; i++)
+      xorshift64s(&scalar.s[i]);
+    for (int i = 0; i < XORSHIFT64S_LANES; i++)
+      ASSERT_EQ(lanes.s[i], scalar.s[i]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: random_init, *_E                                        //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(random_init, stream_0_is_the_seed) {
+  random_init(12345);
+  uint64_t x = 12345;
+  uint64_t s = 12345;
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(xorshift64_E(), xorshift64(&x));
+    ASSERT_EQ(splitmix64_E(), splitmix64(&s));
+  }
+  random_init(0);
+  uint32_t y = 0xF1A6;
+  ASSERT_EQ(xorshift32_E(), xorshift32(&y));
+}
+
+UTEST(random_init, thread_streams) {
+  uint64_t first[3];
+  uint64_t again[3];
+  random_init(7);
+  for (uint64_t stream = 0; stream < 3; stream++) {
+    random_init_thread(stream);
+    first[stream] = xorshift64s_E();
+  }
+  ASSERT_NE(first[0], first[1]);
+  ASSERT_NE(first[1], first[2]);
+  for (uint64_t stream = 3; stream-- > 0;) {
+    random_init_thread(stream);
+    again[stream] = xorshift64s_E();
+  }
+  for (int i = 0; i < 3; i++)
+    ASSERT_EQ(first[i], again[i]);
+}
+
+enum { THREADS = 8, VALUES = 1000 };
+
+static void *generate(void *arg) {
+  uint64_t *out = arg;
+  for (int i = 0; i < VALUES; i++)
+    out[i] = xorshift64s_E() ^ splitmix64_E();
+  return NULL;
+}
+
+// Threads which are not seeded by hand get streams 1 to THREADS, in the
+// order in which they first generate.
+UTEST(random_init, threads) {
+  static uint64_t values[THREADS][VALUES];
+  static uint64_t streams[THREADS][VALUES];
+  pthread_t threads[THREADS];
+  random_init(99);
+  for (int t = 0; t < THREADS; t++)
+    ASSERT_EQ(pthread_create(&threads[t], NULL, generate, values[t]), 0);
+  for (int t = 0; t < THREADS; t++)
+    ASSERT_EQ(pthread_join(threads[t], NULL), 0);
+
+  for (int k = 0; k < THREADS; k++) {
+    random_init_thread((uint64_t)k + 1);
+    generate(streams[k]);
+  }
+
+  int used[THREADS] = {0};
+  for (int t = 0; t < THREADS; t++) {
+    int match = -1;
+    for (int k = 0; k < THREADS; k++) {
+      if (memcmp(values[t], streams[k], sizeof(values[t])) == 0)
+        match = k;
+    }
+    ASSERT_NE(match, -1);
+    ASSERT_FALSE(used[match]);
+    used[match] = 1;
+  }
+  for (int k = 1; k < THREADS; k++)
+    ASSERT_NE(streams[k][0], streams[0][0]);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: *_jump, splitmix64_at                                   //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(random_jump, same_as_steps) {
+  uint32_t x32 = 0xF1A6;
+  uint64_t x64 = 0xDEAD10CC;
+  struct xorshift128_state x128 = {{1, 2, 3, 4}};
+  for (uint64_t n = 0; n < 1000; n++) {
+    uint32_t j32 = 0xF1A6;
+    uint64_t j64 = 0xDEAD10CC;
+    struct xorshift128_state j128 = {{1, 2, 3, 4}};
+    xorshift32_jump(&j32, n);
+    xorshift64_jump(&j64, n);
+    xorshift128_jump(&j128, n);
+    ASSERT_EQ(j32, x32);
+    ASSERT_EQ(j64, x64);
+    ASSERT_EQ(memcmp(&j128, &x128, sizeof(x128)), 0);
+    xorshift32(&x32);
+    xorshift64(&x64);
+    xorshift128(&x128);
+  }
+}
+
+UTEST(random_jump, add_up) {
+  const uint64_t a = 0x123456789ABCDEFULL;
+  const uint64_t b = 0xFEDCBA987654321ULL;
+  uint64_t x = 1;
+  uint64_t y = 1;
+  xorshift64_jump(&x, a);
+  xorshift64_jump(&x, b);
+  xorshift64_jump(&y, a + b);
+  ASSERT_EQ(x, y);
+
+  struct xorshift128_state s = {{5, 6, 7, 8}};
+  struct xorshift128_state t = s;
+  xorshift128_jump(&s, a);
+  xorshift128_jump(&s, b);
+  xorshift128_jump(&t, a + b);
+  ASSERT_EQ(memcmp(&s, &t, sizeof(s)), 0);
+
+  // The period of xorshift32 is 2^32 - 1.
+  uint32_t z = 99;
+  xorshift32_jump(&z, 0xFFFFFFFF);
+  ASSERT_EQ(z, 99u);
+}
+
+UTEST(splitmix64_at, same_as_counter) {
+  uint64_t counter = 42;
+  for (uint64_t i = 0; i < 10; i++) {
+    counter += 0x9E3779B97F4A7C15ULL;
+    ASSERT_EQ(splitmix64_at(42, i), splitmix64_mix(counter));
+  }
+}
+
+UTEST_MAIN()
@@ -3,6 +3,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 // Checks whether a byte, after the first, has the format 10XX_XXXX
 #define utf8_check_byte(b) (((uint8_t)(b & (3 << 6))) == ((uint8_t)(1 << 7)))
 
@@ -97,6 +101,29 @@ int utf8_from_codepoint(utf8_code_pt c, utf8_chr *const buff) {
   return -1;
 }
 
+// Number of bytes of a symbol, indexed by its first byte. Bytes of the form
+// 10XX_XXXX and 1111_1XXX can not start a symbol and map to 0xFF.
+#define X 0xFF
+const uint8_t utf8_sequence_length_table[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, X, X, X, X, X, X, X, X
+};
+#undef X
+
 // Get the number of leading 1s. These indicate the number of bytes used:
 // 0 (b[0] == 0XXX_XXXX) => 1 byte
 // 2 (b[0] == 110X_XXXX) => 2 bytes
@@ -104,29 +131,24 @@ int utf8_from_codepoint(utf8_code_pt c, utf8_chr *const buff) {
 // 4 (b[0] == 1111_0XXX) => 4 bytes
 // Returns a number above 4 on error.
 int utf8_num_bytes_in_next_symbol(const utf8_chr b, bool set_errno) {
-  uint_fast8_t leftmost_zero_bit_index;
-  // Find first position of a 0-bit in number, going from left to right.
-  for (leftmost_zero_bit_index = 7;
-       leftmost_zero_bit_index > 0 && (b & (1 << leftmost_zero_bit_index)) != 0;
-       leftmost_zero_bit_index--) {
-  }
-
-  // Pattern 0XXX_XXXX => single byte (ASCII)
-  if (leftmost_zero_bit_index == 7)
-    return 1;
+  const int len = utf8_sequence_length_table[(uint8_t)b];
 
   // Error-case: invalid bit-pattern
-  // (leftmost_zero_bit_index == 6) means that b has the pattern 10XX_XXXX,
-  // which is not possible. (leftmost_zero_bit_index < 3) means that the pattern
-  // is 1111_10XX, which is also not possible (see above)
-  if (leftmost_zero_bit_index == 6 || leftmost_zero_bit_index < 3) {
-    if (set_errno) {
-      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
-    }
-    return 0xFF;
+  // 10XX_XXXX is only valid after the first byte and 1111_1XXX is not
+  // possible at all.
+  if (len > 4 && set_errno) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
   }
+  return len;
+}
 
-  return 7 - leftmost_zero_bit_index;
+// Whether c, decoded from a symbol of nbytes bytes, is a Unicode scalar value
+// written with as few bytes as possible. Overlong forms, surrogates and
+// values above U+10FFFF fit the bit patterns, but are not valid UTF-8.
+static utf8_inline bool utf8_shortest_scalar(utf8_code_pt c, int nbytes) {
+  static const utf8_code_pt min[5] = {0, 0, 0x80, 0x800, 0x10000};
+  return c >= min[nbytes] && c <= UNICODE_MAX_CODEPT &&
+         (c < 0xD800 || c > 0xDFFF);
 }
 
 // Inline version of utf8_char_valid. Not visible to the outside.
@@ -136,11 +158,13 @@ static utf8_inline bool utf8_char_valid_inline(const utf8_chr *const b) {
     return false;
   if (len == 1)
     return (b[0] & (1 << 7)) == 0;
+  utf8_code_pt c = b[0] & (0x7F >> len);
   for (int i = 1; i < len; i++) {
     if (!utf8_check_byte(b[i]))
       return false;
+    c = (c << 6) | (b[i] & 0x3F);
   }
-  return true;
+  return utf8_shortest_scalar(c, len);
 }
 
 // Checks whether a UTF-8 symbol (as byte pointer) is valid.
@@ -193,6 +217,45 @@ utf8_code_pt utf8_to_codepoint(const utf8_chr *const b) {
   return c;
 }
 
+/**
+ * Decode the next symbol of a buffer with a known length.
+ * Unlike utf8_to_codepoint, this never reads past s[len - 1], so the buffer
+ * does not have to be terminated by 0. Overlong forms, surrogates and values
+ * above U+10FFFF are invalid, so *c is always a Unicode scalar value. Does not
+ * set utf8_lib_error.
+ * @param s The buffer.
+ * @param len Number of bytes left in the buffer.
+ * @param c Output for the codepoint.
+ * @return Number of bytes of the symbol (1..4) or a number below 1 if the
+ * symbol is invalid or cut off by the end of the buffer.
+ */
+int utf8_decode_next(const utf8_chr *const s, size_t len,
+                     utf8_code_pt *const c) {
+  if (len == 0)
+    return 0;
+
+  const uint8_t b0 = (uint8_t)s[0];
+  if (b0 < 0x80) {
+    *c = b0;
+    return 1;
+  }
+
+  const int nbytes = utf8_sequence_length_table[b0];
+  if (nbytes > 4 || (size_t)nbytes > len)
+    return -1;
+
+  utf8_code_pt res = b0 & (0x7F >> nbytes);
+  for (int i = 1; i < nbytes; i++) {
+    if (!utf8_check_byte(s[i]))
+      return -1;
+    res = (res << 6) | (s[i] & 0x3F);
+  }
+  if (!utf8_shortest_scalar(res, nbytes))
+    return -1;
+  *c = res;
+  return nbytes;
+}
+
 // Max long on error
 size_t utf8_strlen(const utf8_chr *const b) {
   size_t res = 0;
@@ -342,3 +405,1017 @@ ssize_t utf8_from_codepoints(const size_t src_cnt,
 
   return codePts_written;
 }
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Reverse iteration                                       //
+//////////////////////////////////////////////////////////////////////
+
+int utf8_decode_prev(const utf8_chr *const s, size_t pos,
+                     utf8_code_pt *const c) {
+  if (pos == 0)
+    return 0;
+
+  const uint8_t last = (uint8_t)s[pos - 1];
+  if (last < 0x80) {
+    *c = last;
+    return 1;
+  }
+
+  // Skip back over at most 3 continuation bytes to the first byte.
+  const size_t limit = pos > 4 ? pos - 4 : 0;
+  size_t start = pos - 1;
+  while (start > limit && utf8_check_byte(s[start]))
+    start--;
+
+  const int nbytes = (int)(pos - start);
+  if (utf8_decode_next(s + start, nbytes, c) != nbytes)
+    return -1;
+  return nbytes;
+}
+
+size_t utf8_prev(const utf8_chr *const s, size_t pos) {
+  utf8_code_pt c;
+  const int nbytes = utf8_decode_prev(s, pos, &c);
+  if (nbytes < 0) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    return pos - 1;
+  }
+  return pos - nbytes;
+}
+
+size_t utf8_truncate_bytes(const utf8_chr *const s, size_t len,
+                           size_t max_bytes) {
+  if (len <= max_bytes)
+    return len;
+
+  // s[max_bytes] is the first byte which is cut off. If it continues a
+  // symbol, find the first byte of that symbol.
+  const size_t limit = max_bytes > 3 ? max_bytes - 3 : 0;
+  size_t start = max_bytes;
+  while (start > limit && utf8_check_byte(s[start]))
+    start--;
+  if (utf8_check_byte(s[start]))
+    return max_bytes;
+
+  const int nbytes = utf8_sequence_length_table[(uint8_t)s[start]];
+  if (nbytes <= 4 && start + nbytes > max_bytes)
+    return start;
+  return max_bytes;
+}
+
+size_t utf8_suffix_offset(const utf8_chr *const s, size_t len, size_t n) {
+  utf8_code_pt c;
+  size_t pos = len;
+  for (size_t i = 0; i < n && pos > 0; i++) {
+    const int nbytes = utf8_decode_prev(s, pos, &c);
+    if (nbytes < 0) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      return SIZE_MAX;
+    }
+    pos -= nbytes;
+  }
+  return pos;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Case folding                                            //
+//////////////////////////////////////////////////////////////////////
+
+// Codepoints first..last fold to codepoint + delta. If stride is 2, only
+// every second codepoint, starting with first, folds.
+struct casefold_range {
+  utf8_code_pt first;
+  utf8_code_pt last;
+  int32_t delta;
+  uint8_t stride;
+};
+
+// Generated from CaseFolding.txt of Unicode 14.0.
+static const struct casefold_range casefold_ranges[] = {
+    {0x0041, 0x005A, 32, 1}, {0x00B5, 0x00B5, 775, 1}, {0x00C0, 0x00D6, 32, 1},
+    {0x00D8, 0x00DE, 32, 1}, {0x0100, 0x012E, 1, 2}, {0x0132, 0x0136, 1, 2},
+    {0x0139, 0x0147, 1, 2}, {0x014A, 0x0176, 1, 2}, {0x0178, 0x0178, -121, 1},
+    {0x0179, 0x017D, 1, 2}, {0x017F, 0x017F, -268, 1}, {0x0181, 0x0181, 210, 1},
+    {0x0182, 0x0184, 1, 2}, {0x0186, 0x0186, 206, 1}, {0x0187, 0x0187, 1, 1},
+    {0x0189, 0x018A, 205, 1}, {0x018B, 0x018B, 1, 1}, {0x018E, 0x018E, 79, 1},
+    {0x018F, 0x018F, 202, 1}, {0x0190, 0x0190, 203, 1}, {0x0191, 0x0191, 1, 1},
+    {0x0193, 0x0193, 205, 1}, {0x0194, 0x0194, 207, 1},
+    {0x0196, 0x0196, 211, 1}, {0x0197, 0x0197, 209, 1}, {0x0198, 0x0198, 1, 1},
+    {0x019C, 0x019C, 211, 1}, {0x019D, 0x019D, 213, 1},
+    {0x019F, 0x019F, 214, 1}, {0x01A0, 0x01A4, 1, 2}, {0x01A6, 0x01A6, 218, 1},
+    {0x01A7, 0x01A7, 1, 1}, {0x01A9, 0x01A9, 218, 1}, {0x01AC, 0x01AC, 1, 1},
+    {0x01AE, 0x01AE, 218, 1}, {0x01AF, 0x01AF, 1, 1}, {0x01B1, 0x01B2, 217, 1},
+    {0x01B3, 0x01B5, 1, 2}, {0x01B7, 0x01B7, 219, 1}, {0x01B8, 0x01B8, 1, 1},
+    {0x01BC, 0x01BC, 1, 1}, {0x01C4, 0x01C4, 2, 1}, {0x01C5, 0x01C5, 1, 1},
+    {0x01C7, 0x01C7, 2, 1}, {0x01C8, 0x01C8, 1, 1}, {0x01CA, 0x01CA, 2, 1},
+    {0x01CB, 0x01DB, 1, 2}, {0x01DE, 0x01EE, 1, 2}, {0x01F1, 0x01F1, 2, 1},
+    {0x01F2, 0x01F4, 1, 2}, {0x01F6, 0x01F6, -97, 1}, {0x01F7, 0x01F7, -56, 1},
+    {0x01F8, 0x021E, 1, 2}, {0x0220, 0x0220, -130, 1}, {0x0222, 0x0232, 1, 2},
+    {0x023A, 0x023A, 10795, 1}, {0x023B, 0x023B, 1, 1},
+    {0x023D, 0x023D, -163, 1}, {0x023E, 0x023E, 10792, 1},
+    {0x0241, 0x0241, 1, 1}, {0x0243, 0x0243, -195, 1}, {0x0244, 0x0244, 69, 1},
+    {0x0245, 0x0245, 71, 1}, {0x0246, 0x024E, 1, 2}, {0x0345, 0x0345, 116, 1},
+    {0x0370, 0x0372, 1, 2}, {0x0376, 0x0376, 1, 1}, {0x037F, 0x037F, 116, 1},
+    {0x0386, 0x0386, 38, 1}, {0x0388, 0x038A, 37, 1}, {0x038C, 0x038C, 64, 1},
+    {0x038E, 0x038F, 63, 1}, {0x0391, 0x03A1, 32, 1}, {0x03A3, 0x03AB, 32, 1},
+    {0x03C2, 0x03C2, 1, 1}, {0x03CF, 0x03CF, 8, 1}, {0x03D0, 0x03D0, -30, 1},
+    {0x03D1, 0x03D1, -25, 1}, {0x03D5, 0x03D5, -15, 1},
+    {0x03D6, 0x03D6, -22, 1}, {0x03D8, 0x03EE, 1, 2}, {0x03F0, 0x03F0, -54, 1},
+    {0x03F1, 0x03F1, -48, 1}, {0x03F4, 0x03F4, -60, 1},
+    {0x03F5, 0x03F5, -64, 1}, {0x03F7, 0x03F7, 1, 1}, {0x03F9, 0x03F9, -7, 1},
+    {0x03FA, 0x03FA, 1, 1}, {0x03FD, 0x03FF, -130, 1}, {0x0400, 0x040F, 80, 1},
+    {0x0410, 0x042F, 32, 1}, {0x0460, 0x0480, 1, 2}, {0x048A, 0x04BE, 1, 2},
+    {0x04C0, 0x04C0, 15, 1}, {0x04C1, 0x04CD, 1, 2}, {0x04D0, 0x052E, 1, 2},
+    {0x0531, 0x0556, 48, 1}, {0x10A0, 0x10C5, 7264, 1},
+    {0x10C7, 0x10C7, 7264, 1}, {0x10CD, 0x10CD, 7264, 1},
+    {0x13F8, 0x13FD, -8, 1}, {0x1C80, 0x1C80, -6222, 1},
+    {0x1C81, 0x1C81, -6221, 1}, {0x1C82, 0x1C82, -6212, 1},
+    {0x1C83, 0x1C84, -6210, 1}, {0x1C85, 0x1C85, -6211, 1},
+    {0x1C86, 0x1C86, -6204, 1}, {0x1C87, 0x1C87, -6180, 1},
+    {0x1C88, 0x1C88, 35267, 1}, {0x1C90, 0x1CBA, -3008, 1},
+    {0x1CBD, 0x1CBF, -3008, 1}, {0x1E00, 0x1E94, 1, 2},
+    {0x1E9B, 0x1E9B, -58, 1}, {0x1E9E, 0x1E9E, -7615, 1},
+    {0x1EA0, 0x1EFE, 1, 2}, {0x1F08, 0x1F0F, -8, 1}, {0x1F18, 0x1F1D, -8, 1},
+    {0x1F28, 0x1F2F, -8, 1}, {0x1F38, 0x1F3F, -8, 1}, {0x1F48, 0x1F4D, -8, 1},
+    {0x1F59, 0x1F5F, -8, 2}, {0x1F68, 0x1F6F, -8, 1}, {0x1F88, 0x1F8F, -8, 1},
+    {0x1F98, 0x1F9F, -8, 1}, {0x1FA8, 0x1FAF, -8, 1}, {0x1FB8, 0x1FB9, -8, 1},
+    {0x1FBA, 0x1FBB, -74, 1}, {0x1FBC, 0x1FBC, -9, 1},
+    {0x1FBE, 0x1FBE, -7173, 1}, {0x1FC8, 0x1FCB, -86, 1},
+    {0x1FCC, 0x1FCC, -9, 1}, {0x1FD8, 0x1FD9, -8, 1}, {0x1FDA, 0x1FDB, -100, 1},
+    {0x1FE8, 0x1FE9, -8, 1}, {0x1FEA, 0x1FEB, -112, 1}, {0x1FEC, 0x1FEC, -7, 1},
+    {0x1FF8, 0x1FF9, -128, 1}, {0x1FFA, 0x1FFB, -126, 1},
+    {0x1FFC, 0x1FFC, -9, 1}, {0x2126, 0x2126, -7517, 1},
+    {0x212A, 0x212A, -8383, 1}, {0x212B, 0x212B, -8262, 1},
+    {0x2132, 0x2132, 28, 1}, {0x2160, 0x216F, 16, 1}, {0x2183, 0x2183, 1, 1},
+    {0x24B6, 0x24CF, 26, 1}, {0x2C00, 0x2C2F, 48, 1}, {0x2C60, 0x2C60, 1, 1},
+    {0x2C62, 0x2C62, -10743, 1}, {0x2C63, 0x2C63, -3814, 1},
+    {0x2C64, 0x2C64, -10727, 1}, {0x2C67, 0x2C6B, 1, 2},
+    {0x2C6D, 0x2C6D, -10780, 1}, {0x2C6E, 0x2C6E, -10749, 1},
+    {0x2C6F, 0x2C6F, -10783, 1}, {0x2C70, 0x2C70, -10782, 1},
+    {0x2C72, 0x2C72, 1, 1}, {0x2C75, 0x2C75, 1, 1}, {0x2C7E, 0x2C7F, -10815, 1},
+    {0x2C80, 0x2CE2, 1, 2}, {0x2CEB, 0x2CED, 1, 2}, {0x2CF2, 0x2CF2, 1, 1},
+    {0xA640, 0xA66C, 1, 2}, {0xA680, 0xA69A, 1, 2}, {0xA722, 0xA72E, 1, 2},
+    {0xA732, 0xA76E, 1, 2}, {0xA779, 0xA77B, 1, 2}, {0xA77D, 0xA77D, -35332, 1},
+    {0xA77E, 0xA786, 1, 2}, {0xA78B, 0xA78B, 1, 1}, {0xA78D, 0xA78D, -42280, 1},
+    {0xA790, 0xA792, 1, 2}, {0xA796, 0xA7A8, 1, 2}, {0xA7AA, 0xA7AA, -42308, 1},
+    {0xA7AB, 0xA7AB, -42319, 1}, {0xA7AC, 0xA7AC, -42315, 1},
+    {0xA7AD, 0xA7AD, -42305, 1}, {0xA7AE, 0xA7AE, -42308, 1},
+    {0xA7B0, 0xA7B0, -42258, 1}, {0xA7B1, 0xA7B1, -42282, 1},
+    {0xA7B2, 0xA7B2, -42261, 1}, {0xA7B3, 0xA7B3, 928, 1},
+    {0xA7B4, 0xA7C2, 1, 2}, {0xA7C4, 0xA7C4, -48, 1},
+    {0xA7C5, 0xA7C5, -42307, 1}, {0xA7C6, 0xA7C6, -35384, 1},
+    {0xA7C7, 0xA7C9, 1, 2}, {0xA7D0, 0xA7D0, 1, 1}, {0xA7D6, 0xA7D8, 1, 2},
+    {0xA7F5, 0xA7F5, 1, 1}, {0xAB70, 0xABBF, -38864, 1},
+    {0xFF21, 0xFF3A, 32, 1}, {0x10400, 0x10427, 40, 1},
+    {0x104B0, 0x104D3, 40, 1}, {0x10570, 0x1057A, 39, 1},
+    {0x1057C, 0x1058A, 39, 1}, {0x1058C, 0x10592, 39, 1},
+    {0x10594, 0x10595, 39, 1}, {0x10C80, 0x10CB2, 64, 1},
+    {0x118A0, 0x118BF, 32, 1}, {0x16E40, 0x16E5F, 32, 1},
+    {0x1E900, 0x1E921, 34, 1},
+};
+
+utf8_code_pt utf8_casefold_codepoint(const utf8_code_pt c) {
+  if (c < 0x80)
+    return (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+
+  size_t lo = 0;
+  size_t hi = sizeof(casefold_ranges) / sizeof(casefold_ranges[0]);
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    const struct casefold_range *const r = &casefold_ranges[mid];
+    if (c > r->last) {
+      lo = mid + 1;
+    } else if (c < r->first) {
+      hi = mid;
+    } else {
+      if (r->stride == 2 && ((c - r->first) & 1) != 0)
+        return c;
+      return (utf8_code_pt)((int32_t)c + r->delta);
+    }
+  }
+  return c;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Escaping                                                //
+//////////////////////////////////////////////////////////////////////
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// Whether a byte has to be escaped in a style.
+static utf8_inline bool needs_escape(const uint8_t b,
+                                     const enum utf8_escape_style style) {
+  switch (style) {
+  case UTF8_ESCAPE_JSON:
+    return b < 0x20 || b == '"' || b == '\\';
+  case UTF8_ESCAPE_C:
+    return b < 0x20 || b == 0x7F || b == '"' || b == '\\';
+  default:
+    return b == '\'';
+  }
+}
+
+/**
+ * Find the first byte which has to be escaped. Runs of clean bytes are
+ * skipped 16 bytes at a time.
+ * @return Index of the first byte to escape or len if there is none.
+ */
+static size_t find_escape(const uint8_t *const s, const size_t len,
+                          const enum utf8_escape_style style) {
+  size_t i = 0;
+
+#if defined(__SSE2__)
+  // The shell style only escapes single quotes, so every comparison looks
+  // for them.
+  const bool shell = style == UTF8_ESCAPE_SHELL;
+  const __m128i quote = _mm_set1_epi8(shell ? '\'' : '"');
+  const __m128i backslash = _mm_set1_epi8(shell ? '\'' : '\\');
+  const __m128i del =
+      _mm_set1_epi8(style == UTF8_ESCAPE_C ? 0x7F : (shell ? '\'' : '"'));
+  // Control characters are 0x00..0x1F. The comparison is signed, so bytes
+  // above 0x7F are negative and have to be excluded.
+  const __m128i space = _mm_set1_epi8(shell ? 0 : 0x20);
+  const __m128i minus_one = _mm_set1_epi8(-1);
+
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    const __m128i ctrl =
+        _mm_and_si128(_mm_cmplt_epi8(v, space), _mm_cmpgt_epi8(v, minus_one));
+    const __m128i special =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                                  _mm_cmpeq_epi8(v, backslash)),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, del), ctrl));
+    const unsigned mask = (unsigned)_mm_movemask_epi8(special);
+    if (mask != 0)
+      return i + (size_t)__builtin_ctz(mask);
+  }
+#endif
+
+  while (i < len && !needs_escape(s[i], style))
+    i++;
+  return i;
+}
+
+// Write the escaped form of a byte which needs escaping. Returns the number
+// of bytes written (at most 6).
+static int escape_byte(const uint8_t b, const enum utf8_escape_style style,
+                       utf8_chr *const out) {
+  if (style == UTF8_ESCAPE_SHELL) {
+    // Close the quote, add an escaped quote, open the quote again.
+    memcpy(out, "'\\''", 4);
+    return 4;
+  }
+
+  out[0] = '\\';
+  switch (b) {
+  case '"':
+  case '\\':
+    out[1] = (utf8_chr)b;
+    return 2;
+  case '\b':
+    out[1] = 'b';
+    return 2;
+  case '\f':
+    out[1] = 'f';
+    return 2;
+  case '\n':
+    out[1] = 'n';
+    return 2;
+  case '\r':
+    out[1] = 'r';
+    return 2;
+  case '\t':
+    out[1] = 't';
+    return 2;
+  }
+
+  if (style == UTF8_ESCAPE_JSON) {
+    memcpy(out + 1, "u00", 3);
+    out[4] = hex_digits[b >> 4];
+    out[5] = hex_digits[b & 0xF];
+    return 6;
+  }
+
+  // Octal, because \x in C does not stop after two digits.
+  out[1] = (utf8_chr)('0' + (b >> 6));
+  out[2] = (utf8_chr)('0' + ((b >> 3) & 7));
+  out[3] = (utf8_chr)('0' + (b & 7));
+  return 4;
+}
+
+size_t utf8_escaped_size(const utf8_chr *const s, size_t len,
+                         enum utf8_escape_style style) {
+  const uint8_t *const b = (const uint8_t *)s;
+  utf8_chr temp[6];
+  size_t size = style == UTF8_ESCAPE_SHELL ? len + 2 : len;
+
+  for (size_t i = find_escape(b, len, style); i < len;
+       i += 1 + find_escape(b + i + 1, len - i - 1, style)) {
+    size += escape_byte(b[i], style, temp) - 1;
+  }
+  return size;
+}
+
+size_t utf8_escape(const utf8_chr *const s, size_t len,
+                   enum utf8_escape_style style, utf8_chr *const dest) {
+  const uint8_t *const b = (const uint8_t *)s;
+  size_t written = 0;
+
+  if (style == UTF8_ESCAPE_SHELL)
+    dest[written++] = '\'';
+
+  for (size_t i = 0; i < len;) {
+    const size_t clean = find_escape(b + i, len - i, style);
+    memcpy(dest + written, s + i, clean);
+    written += clean;
+    i += clean;
+    if (i < len) {
+      written += escape_byte(b[i], style, dest + written);
+      i++;
+    }
+  }
+
+  if (style == UTF8_ESCAPE_SHELL)
+    dest[written++] = '\'';
+  return written;
+}
+
+// Parse count hex digits. Returns -1 if one of them is not a hex digit.
+static int32_t parse_hex(const uint8_t *const s, const int count) {
+  int32_t res = 0;
+  for (int i = 0; i < count; i++) {
+    const uint8_t c = s[i];
+    int digit;
+    if (c >= '0' && c <= '9')
+      digit = c - '0';
+    else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+      digit = (c | 0x20) - 'a' + 10;
+    else
+      return -1;
+    res = (res << 4) | digit;
+  }
+  return res;
+}
+
+// Decode a JSON \uXXXX escape at s (pointing to the 'u'), including a
+// following low surrogate. Returns the number of bytes used or -1 on error.
+static int unescape_json_u(const uint8_t *const s, const size_t left,
+                           utf8_code_pt *const c) {
+  if (left < 5)
+    return -1;
+  const int32_t hi = parse_hex(s + 1, 4);
+  if (hi < 0)
+    return -1;
+  *c = (utf8_code_pt)hi;
+  // A high surrogate followed by a low surrogate. Lone surrogates are
+  // returned as they are.
+  if (hi < 0xD800 || hi > 0xDBFF || left < 11 || s[5] != '\\' || s[6] != 'u')
+    return 5;
+  const int32_t lo = parse_hex(s + 7, 4);
+  if (lo < 0xDC00 || lo > 0xDFFF)
+    return 5;
+  *c = 0x10000 + (((utf8_code_pt)hi - 0xD800) << 10) +
+       ((utf8_code_pt)lo - 0xDC00);
+  return 11;
+}
+
+// Decode a C escape sequence at s (pointing after the backslash).
+// Returns the number of bytes used or -1 on error. Escapes which produce
+// a single byte set *byte instead of *c.
+static int unescape_c(const uint8_t *const s, const size_t left,
+                      utf8_code_pt *const c, int *const byte) {
+  *byte = -1;
+  switch (s[0]) {
+  case 'a':
+    *byte = '\a';
+    return 1;
+  case 'b':
+    *byte = '\b';
+    return 1;
+  case 'f':
+    *byte = '\f';
+    return 1;
+  case 'n':
+    *byte = '\n';
+    return 1;
+  case 'r':
+    *byte = '\r';
+    return 1;
+  case 't':
+    *byte = '\t';
+    return 1;
+  case 'v':
+    *byte = '\v';
+    return 1;
+  case '\\':
+  case '\'':
+  case '"':
+  case '?':
+    *byte = s[0];
+    return 1;
+  case 'x': {
+    size_t n = 1;
+    int32_t value = 0;
+    while (n < left && parse_hex(s + n, 1) >= 0) {
+      value = (value << 4) | parse_hex(s + n, 1);
+      if (value > 0xFF)
+        return -1;
+      n++;
+    }
+    if (n == 1)
+      return -1;
+    *byte = value;
+    return (int)n;
+  }
+  case 'u':
+  case 'U': {
+    const int digits = s[0] == 'u' ? 4 : 8;
+    if (left < (size_t)digits + 1)
+      return -1;
+    const int32_t value = parse_hex(s + 1, digits);
+    if (value < 0)
+      return -1;
+    *c = (utf8_code_pt)value;
+    return digits + 1;
+  }
+  }
+
+  if (s[0] >= '0' && s[0] <= '7') {
+    int n = 0;
+    int value = 0;
+    while (n < 3 && (size_t)n < left && s[n] >= '0' && s[n] <= '7') {
+      value = (value << 3) | (s[n] - '0');
+      n++;
+    }
+    if (value > 0xFF)
+      return -1;
+    *byte = value;
+    return n;
+  }
+  return -1;
+}
+
+// Undo the quoting of utf8_escape(..., UTF8_ESCAPE_SHELL, ...). Accepts any
+// sequence of single-quoted parts and backslash-escaped characters.
+static ssize_t unescape_shell(const uint8_t *const s, const size_t len,
+                              utf8_chr *const dest) {
+  size_t written = 0;
+  bool quoted = false;
+
+  for (size_t i = 0; i < len;) {
+    if (quoted) {
+      const uint8_t *const end = memchr(s + i, '\'', len - i);
+      const size_t n = end ? (size_t)(end - (s + i)) : len - i;
+      memcpy(dest + written, s + i, n);
+      written += n;
+      i += n;
+      if (end) {
+        quoted = false;
+        i++;
+      }
+    } else if (s[i] == '\'') {
+      quoted = true;
+      i++;
+    } else if (s[i] == '\\' && i + 1 < len) {
+      dest[written++] = (utf8_chr)s[i + 1];
+      i += 2;
+    } else {
+      dest[written++] = (utf8_chr)s[i++];
+    }
+  }
+
+  if (quoted) {
+    set_utf8_lib_error(INVALID_ESCAPE_SEQUENCE);
+    return -1;
+  }
+  return (ssize_t)written;
+}
+
+ssize_t utf8_unescape(const utf8_chr *const s, size_t len,
+                      enum utf8_escape_style style, utf8_chr *const dest) {
+  const uint8_t *const b = (const uint8_t *)s;
+  size_t written = 0;
+
+  if (style == UTF8_ESCAPE_SHELL)
+    return unescape_shell(b, len, dest);
+
+  for (size_t i = 0; i < len;) {
+    const uint8_t *const bs = memchr(b + i, '\\', len - i);
+    const size_t clean = bs ? (size_t)(bs - (b + i)) : len - i;
+    memcpy(dest + written, s + i, clean);
+    written += clean;
+    i += clean;
+    if (i == len)
+      break;
+
+    // b[i] is a backslash.
+    i++;
+    if (i == len) {
+      set_utf8_lib_error(INVALID_ESCAPE_SEQUENCE);
+      return -1;
+    }
+
+    utf8_code_pt c = 0;
+    int byte = -1;
+    int used;
+    if (style == UTF8_ESCAPE_JSON) {
+      switch (b[i]) {
+      case '"':
+      case '\\':
+      case '/':
+        byte = b[i];
+        used = 1;
+        break;
+      case 'b':
+        byte = '\b';
+        used = 1;
+        break;
+      case 'f':
+        byte = '\f';
+        used = 1;
+        break;
+      case 'n':
+        byte = '\n';
+        used = 1;
+        break;
+      case 'r':
+        byte = '\r';
+        used = 1;
+        break;
+      case 't':
+        byte = '\t';
+        used = 1;
+        break;
+      case 'u':
+        used = unescape_json_u(b + i, len - i, &c);
+        break;
+      default:
+        used = -1;
+      }
+    } else {
+      used = unescape_c(b + i, len - i, &c, &byte);
+    }
+
+    if (used < 0) {
+      set_utf8_lib_error(INVALID_ESCAPE_SEQUENCE);
+      return -1;
+    }
+    i += used;
+
+    if (byte >= 0) {
+      dest[written++] = (utf8_chr)byte;
+    } else {
+      // Lone surrogates can not be represented in UTF-8.
+      if (c >= 0xD800 && c <= 0xDFFF) {
+        set_utf8_lib_error(INVALID_UNICODE_CODEPOINT);
+        return -1;
+      }
+      const int n = utf8_from_codepoint(c, dest + written);
+      if (n < 1)
+        return -1; // INVALID_UNICODE_CODEPOINT was already set.
+      written += n;
+    }
+  }
+
+  return (ssize_t)written;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Spans                                                   //
+//////////////////////////////////////////////////////////////////////
+
+// Length of the run of ASCII bytes at the start of s.
+static size_t ascii_prefix(const uint8_t *const s, const size_t len) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= len; i += 16) {
+    const int mask =
+        _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i)));
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+#endif
+  while (i < len && s[i] < 0x80)
+    i++;
+  return i;
+}
+
+struct utf8_span utf8_span_make(const utf8_chr *const s, size_t len) {
+  const uint8_t *const b = (const uint8_t *)s;
+  struct utf8_span span = {s, len, 0, UTF8_SPAN_ASCII | UTF8_SPAN_VALID};
+
+  size_t i = ascii_prefix(b, len);
+  size_t count = i;
+  if (i < len)
+    span.flags = UTF8_SPAN_VALID;
+  while (i < len) {
+    if (b[i] < 0x80) {
+      const size_t run = ascii_prefix(b + i, len - i);
+      i += run;
+      count += run;
+      continue;
+    }
+    utf8_code_pt c;
+    const int n = utf8_decode_next(s + i, len - i, &c);
+    if (n < 1) {
+      span.flags = 0;
+      span.count = SIZE_MAX;
+      return span;
+    }
+    i += n;
+    count++;
+  }
+  span.count = count;
+  return span;
+}
+
+struct utf8_span utf8_span_from_cstr(const utf8_chr *const s) {
+  return utf8_span_make(s, strlen(s));
+}
+
+size_t utf8_span_offset(const struct utf8_span *const s, size_t n) {
+  if (!utf8_span_valid(s)) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    return SIZE_MAX;
+  }
+  if (n >= s->count)
+    return s->len;
+  if (utf8_span_is_ascii(s))
+    return n;
+  // Valid UTF-8 has exactly one byte per codepoint which is no continuation
+  // byte, so no symbol has to be decoded.
+  size_t i = 0;
+  for (; n > 0; i++)
+    n -= ((uint8_t)s->data[i + 1] & 0xC0) != 0x80;
+  return i;
+}
+
+struct utf8_span utf8_span_sub(const struct utf8_span *const s, size_t start,
+                               size_t count) {
+  struct utf8_span span = {s->data, 0, 0, UTF8_SPAN_ASCII | UTF8_SPAN_VALID};
+  const size_t begin = utf8_span_offset(s, start);
+  if (begin == SIZE_MAX)
+    return span;
+  const size_t left = start < s->count ? s->count - start : 0;
+  if (count > left)
+    count = left;
+
+  span.data = s->data + begin;
+  span.count = count;
+  if (utf8_span_is_ascii(s)) {
+    span.len = count;
+    return span;
+  }
+  const struct utf8_span rest = {span.data, s->len - begin, left,
+                                 UTF8_SPAN_VALID};
+  span.len = utf8_span_offset(&rest, count);
+  if (span.len != count)
+    span.flags = UTF8_SPAN_VALID;
+  return span;
+}
+
+const utf8_chr *utf8_span_chr(const struct utf8_span *const s,
+                              utf8_code_pt c) {
+  if (!utf8_span_valid(s)) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    return NULL;
+  }
+  if (c < 0x80)
+    return memchr(s->data, (int)c, s->len);
+  utf8_chr needle[4];
+  if (utf8_span_is_ascii(s) || c > UNICODE_MAX_CODEPT)
+    return NULL;
+  const int n = utf8_from_codepoint(c, needle);
+  // In valid UTF-8, the bytes of a symbol never match in the middle of
+  // another symbol.
+  const utf8_chr *p = s->data;
+  const utf8_chr *const end = s->data + s->len;
+  while (end - p >= n && (p = memchr(p, needle[0], end - p - n + 1))) {
+    if (memcmp(p, needle, n) == 0)
+      return p;
+    p++;
+  }
+  return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Batches                                                 //
+//////////////////////////////////////////////////////////////////////
+
+// Classes of bytes for batch_next:
+// 0 ASCII, 1 to 3 continuation bytes 0x80-0x8F, 0x90-0x9F and 0xA0-0xBF,
+// 4 first bytes of 2 bytes (0xC2-0xDF), 5 0xE0, 6 other first bytes of 3
+// bytes, 7 0xED, 8 0xF0, 9 0xF1-0xF3, 10 0xF4 and 11 never valid.
+static const uint8_t batch_class[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+    11, 11,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  6,  6,
+     8,  9,  9,  9, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11
+};
+
+// DFA which accepts the same strings as utf8_string_valid, indexed by
+// state * 16 + class. State 0 is between symbols, states 1 to 3 wait for
+// that many continuation bytes, states 4 to 7 wait for the restricted second
+// byte after 0xE0, 0xED, 0xF0 and 0xF4, which rules out overlong forms,
+// surrogates and values above U+10FFFF. State 8 has seen an error.
+#define E 8
+static const uint8_t batch_next[9 * 16] = {
+    // ASCII, 80-8F, 90-9F, A0-BF, C2-DF, E0, E1-EF, ED, F0, F1-F3, F4, other
+    0, E, E, E, 1, 4, 2, 5, 6, 3, 7, E, E, E, E, E, // between symbols
+    E, 0, 0, 0, E, E, E, E, E, E, E, E, E, E, E, E, // 1 byte missing
+    E, 1, 1, 1, E, E, E, E, E, E, E, E, E, E, E, E, // 2 bytes missing
+    E, 2, 2, 2, E, E, E, E, E, E, E, E, E, E, E, E, // 3 bytes missing
+    E, E, E, 1, E, E, E, E, E, E, E, E, E, E, E, E, // after E0
+    E, 1, 1, E, E, E, E, E, E, E, E, E, E, E, E, E, // after ED
+    E, E, 2, 2, E, E, E, E, E, E, E, E, E, E, E, E, // after F0
+    E, 2, E, E, E, E, E, E, E, E, E, E, E, E, E, E, // after F4
+    E, E, E, E, E, E, E, E, E, E, E, E, E, E, E, E, // error
+};
+#undef E
+
+// Continuation bytes are the classes 1 to 3.
+#define BATCH_CONTINUATION(c) ((unsigned)(c)-1 < 3)
+
+static utf8_inline bool batch_ascii(const uint8_t *const s, const size_t len) {
+  uint64_t acc = 0;
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, s + i, 8);
+    acc |= word;
+  }
+  for (; i < len; i++)
+    acc |= s[i];
+  return (acc & 0x8080808080808080ULL) == 0;
+}
+
+// Run the DFA over four strings at once. res[k] receives the number of
+// codepoints of string k, or SIZE_MAX if it is invalid.
+static void batch_check4(const uint8_t *const s[4], const size_t len[4],
+                         size_t res[4]) {
+  size_t common = len[0];
+  for (int k = 1; k < 4; k++)
+    common = len[k] < common ? len[k] : common;
+
+  // The four chains of lookups do not depend on each other, so their loads
+  // overlap.
+  unsigned st0 = 0, st1 = 0, st2 = 0, st3 = 0;
+  size_t cont[4] = {0, 0, 0, 0};
+  for (size_t i = 0; i < common; i++) {
+    const unsigned c0 = batch_class[s[0][i]];
+    const unsigned c1 = batch_class[s[1][i]];
+    const unsigned c2 = batch_class[s[2][i]];
+    const unsigned c3 = batch_class[s[3][i]];
+    st0 = batch_next[st0 * 16 + c0];
+    st1 = batch_next[st1 * 16 + c1];
+    st2 = batch_next[st2 * 16 + c2];
+    st3 = batch_next[st3 * 16 + c3];
+    cont[0] += BATCH_CONTINUATION(c0);
+    cont[1] += BATCH_CONTINUATION(c1);
+    cont[2] += BATCH_CONTINUATION(c2);
+    cont[3] += BATCH_CONTINUATION(c3);
+  }
+
+  const unsigned states[4] = {st0, st1, st2, st3};
+  for (int k = 0; k < 4; k++) {
+    unsigned st = states[k];
+    for (size_t i = common; i < len[k]; i++) {
+      const unsigned c = batch_class[s[k][i]];
+      st = batch_next[st * 16 + c];
+      cont[k] += BATCH_CONTINUATION(c);
+    }
+    res[k] = st == 0 ? len[k] - cont[k] : SIZE_MAX;
+  }
+}
+
+// Strings which are waiting for batch_check4.
+struct batch_group {
+  const uint8_t *s[4];
+  size_t len[4];
+  size_t index[4];
+  int n;
+};
+
+// Check the strings of a group and store the results into counts or, as
+// validity, into valid. Returns false if one of them is invalid.
+static bool batch_flush(struct batch_group *const g, size_t *counts,
+                        bool *valid) {
+  static const uint8_t empty[1] = {0};
+  size_t res[4];
+  bool all_valid = true;
+
+  // Fill up the group with empty strings.
+  for (int k = g->n; k < 4; k++) {
+    g->s[k] = empty;
+    g->len[k] = 0;
+  }
+  batch_check4(g->s, g->len, res);
+  for (int k = 0; k < g->n; k++) {
+    all_valid &= res[k] != SIZE_MAX;
+    if (counts)
+      counts[g->index[k]] = res[k];
+    else
+      valid[g->index[k]] = res[k] != SIZE_MAX;
+  }
+  g->n = 0;
+  return all_valid;
+}
+
+// Codepoint counts of all strings, stored like in batch_flush. Returns
+// false if a string is invalid.
+static bool batch_lengths(const utf8_chr *const *strs, const size_t *lens,
+                          size_t n, size_t *counts, bool *valid) {
+  struct batch_group g;
+  bool all_valid = true;
+  g.n = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t *const s = (const uint8_t *)strs[i];
+    if (batch_ascii(s, lens[i])) {
+      if (counts)
+        counts[i] = lens[i];
+      else
+        valid[i] = true;
+      continue;
+    }
+    g.s[g.n] = s;
+    g.len[g.n] = lens[i];
+    g.index[g.n] = i;
+    if (++g.n == 4)
+      all_valid &= batch_flush(&g, counts, valid);
+  }
+  if (g.n > 0)
+    all_valid &= batch_flush(&g, counts, valid);
+  return all_valid;
+}
+
+void utf8_valid_batch(const utf8_chr *const *strs, const size_t *lens,
+                      size_t n, bool *valid) {
+  batch_lengths(strs, lens, n, NULL, valid);
+}
+
+void utf8_strlen_batch(const utf8_chr *const *strs, const size_t *lens,
+                       size_t n, size_t *counts) {
+  if (!batch_lengths(strs, lens, n, counts, NULL))
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Variants                                                //
+//////////////////////////////////////////////////////////////////////
+
+// Length of the symbol at s if it is not ASCII and written the same way in
+// every variant: 2 or 3 bytes, no surrogate and not overlong. 0 otherwise.
+static utf8_inline int common_symbol(const uint8_t *const s, size_t left) {
+  const uint8_t b0 = s[0];
+  if (b0 >= 0xC2 && b0 <= 0xDF)
+    return left >= 2 && utf8_check_byte(s[1]) ? 2 : 0;
+  if (b0 < 0xE0 || b0 > 0xEF || left < 3 || !utf8_check_byte(s[1]) ||
+      !utf8_check_byte(s[2]))
+    return 0;
+  if ((b0 == 0xE0 && s[1] < 0xA0) || (b0 == 0xED && s[1] >= 0xA0))
+    return 0;
+  return 3;
+}
+
+// Length of the run at the start of s which is written the same way in both
+// variants. 0 bytes end the run if stop_at_zero is set.
+static size_t common_run(const uint8_t *const s, const size_t len,
+                         const bool stop_at_zero) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+#endif
+  while (i < len) {
+#if defined(__SSE2__)
+    if (i + 16 <= len) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+      int mask = _mm_movemask_epi8(v);
+      if (stop_at_zero)
+        mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+      if (mask == 0) {
+        i += 16;
+        continue;
+      }
+      i += __builtin_ctz(mask);
+    }
+#endif
+    if (s[i] < 0x80) {
+      if (s[i] == 0 && stop_at_zero)
+        break;
+      i++;
+      continue;
+    }
+    const int n = common_symbol(s + i, len - i);
+    if (n == 0)
+      break;
+    i += n;
+  }
+  return i;
+}
+
+// Value of the surrogate written at s, or 0 if there is none.
+static utf8_inline utf8_code_pt surrogate_at(const uint8_t *const s,
+                                             size_t left) {
+  if (left < 3 || s[0] != 0xED || s[1] < 0xA0 || s[1] > 0xBF ||
+      !utf8_check_byte(s[2]))
+    return 0;
+  return 0xD000 | ((utf8_code_pt)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+}
+
+// Value of the 4-byte symbol at s, or 0 if there is none.
+static utf8_inline utf8_code_pt supplementary_at(const uint8_t *const s,
+                                                 size_t left) {
+  if (left < 4 || s[0] < 0xF0 || s[0] > 0xF4 || !utf8_check_byte(s[1]) ||
+      !utf8_check_byte(s[2]) || !utf8_check_byte(s[3]))
+    return 0;
+  if ((s[0] == 0xF0 && s[1] < 0x90) || (s[0] == 0xF4 && s[1] > 0x8F))
+    return 0;
+  return ((utf8_code_pt)(s[0] & 0x07) << 18) |
+         ((utf8_code_pt)(s[1] & 0x3F) << 12) |
+         ((utf8_code_pt)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+}
+
+size_t utf8_transcode_bound(size_t len, enum utf8_variant to) {
+  // U+0000 grows from 1 to 2 bytes, 4-byte symbols grow to 6 bytes.
+  if (to == UTF8_VARIANT_MODIFIED)
+    return 2 * len;
+  if (to == UTF8_VARIANT_CESU8)
+    return len + len / 2;
+  return len;
+}
+
+ssize_t utf8_transcode(const utf8_chr *const s, size_t len,
+                       enum utf8_variant from, enum utf8_variant to,
+                       utf8_chr *const dest) {
+  const uint8_t *const b = (const uint8_t *)s;
+  const bool pairs_from = from >= UTF8_VARIANT_CESU8;
+  const bool pairs_to = to >= UTF8_VARIANT_CESU8;
+  size_t written = 0;
+
+  for (size_t i = 0; i < len;) {
+    const size_t run = common_run(b + i, len - i, to == UTF8_VARIANT_MODIFIED);
+    memcpy(dest + written, s + i, run);
+    written += run;
+    i += run;
+    if (i == len)
+      break;
+
+    utf8_code_pt c;
+    int n;
+    if (b[i] == 0) {
+      c = 0;
+      n = 1;
+    } else if (from == UTF8_VARIANT_MODIFIED && b[i] == 0xC0 &&
+               len - i >= 2 && b[i + 1] == 0x80) {
+      c = 0;
+      n = 2;
+    } else if ((c = surrogate_at(b + i, len - i)) != 0) {
+      n = 3;
+      const utf8_code_pt low =
+          c < 0xDC00 ? surrogate_at(b + i + 3, len - i - 3) : 0;
+      // WTF-8 writes pairs as one symbol, so a pair is an error there.
+      if (from == UTF8_VARIANT_STANDARD || (low >= 0xDC00 && !pairs_from)) {
+        set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+        return -1;
+      }
+      if (low >= 0xDC00) {
+        c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+        n = 6;
+      }
+    } else if ((c = supplementary_at(b + i, len - i)) != 0 && !pairs_from) {
+      n = 4;
+    } else {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      return -1;
+    }
+    i += n;
+
+    if (c == 0 && to == UTF8_VARIANT_MODIFIED) {
+      dest[written++] = (utf8_chr)0xC0;
+      dest[written++] = (utf8_chr)0x80;
+    } else if (c >= 0x10000 && pairs_to) {
+      c -= 0x10000;
+      written += utf8_from_codepoint(0xD800 + (c >> 10), dest + written);
+      written += utf8_from_codepoint(0xDC00 + (c & 0x3FF), dest + written);
+    } else if (c >= 0xD800 && c <= 0xDFFF && to == UTF8_VARIANT_STANDARD) {
+      set_utf8_lib_error(INVALID_UNICODE_CODEPOINT);
+      return -1;
+    } else {
+      written += utf8_from_codepoint(c, dest + written);
+    }
+  }
+  return (ssize_t)written;
+}
@@ -6,6 +6,10 @@
 #include <stdint.h>
 #include <unistd.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #ifdef _MSC_VER
 #define utf8_inline __forceinline
 #elif defined(__GNUC__)
@@ -34,8 +38,14 @@ typedef uint32_t utf8_code_pt;
 
 // 1: Invalid unicode codepoint
 // 2: Invalid utf-8 symbol
+// 3: Invalid escape sequence
+// 4: Invalid pattern
+// 5: Number out of range
 #define INVALID_UNICODE_CODEPOINT 1
 #define INVALID_UTF8_SYMBOL 2
+#define INVALID_ESCAPE_SEQUENCE 3
+#define INVALID_PATTERN 4
+#define NUMBER_OUT_OF_RANGE 5
 
 #define UNICODE_MAX_CODEPT 0x10FFFF
 
@@ -61,9 +71,39 @@ ssize_t utf8_from_codepoints(const size_t src_cnt,
 // Returns MAX_INT (~0) on error.
 utf8_code_pt utf8_to_codepoint(const utf8_chr *const);
 
-// Checks whether a UTF-8 symbol (as byte pointer) is valid.
+// Checks whether a UTF-8 symbol (as byte pointer) is valid. Overlong forms,
+// surrogates and values above U+10FFFF are invalid.
 bool utf8_char_valid(const utf8_chr *const);
 
+// Decode the next symbol of a buffer of len bytes into *c.
+// Returns the number of bytes of the symbol or a number below 1 if the symbol
+// is invalid or cut off by the end of the buffer. Overlong forms, surrogates
+// and values above U+10FFFF are invalid.
+int utf8_decode_next(const utf8_chr *const, size_t len, utf8_code_pt *const c);
+
+// Decode the symbol which ends right before offset pos into *c. Looks at no
+// more than the 4 bytes before pos.
+// Returns the number of bytes of the symbol, 0 if pos is 0, or a number
+// below 0 if the bytes before pos do not end with a valid symbol.
+int utf8_decode_prev(const utf8_chr *const, size_t pos, utf8_code_pt *const c);
+
+// Offset of the symbol which ends right before offset pos. Looks at no more
+// than the 4 bytes before pos, so the front of the string is never touched.
+// Returns 0 if pos is 0. If the bytes before pos are invalid, sets
+// utf8_lib_error and returns pos - 1, so that iteration can go on.
+size_t utf8_prev(const utf8_chr *const, size_t pos);
+
+// Largest length of at most max_bytes which does not cut a symbol of the
+// len byte string in two. Looks at no more than 4 bytes around max_bytes.
+// Invalid bytes are treated as symbols of their own.
+size_t utf8_truncate_bytes(const utf8_chr *const, size_t len,
+                           size_t max_bytes);
+
+// Offset of the last n symbols of a len byte string, found by decoding
+// backwards from the end. Returns 0 if the string has n symbols or less.
+// On error, sets utf8_lib_error and returns SIZE_MAX.
+size_t utf8_suffix_offset(const utf8_chr *const, size_t len, size_t n);
+
 size_t utf8_strlen(const utf8_chr *const);
 
 int utf8_str_cmp(const utf8_chr *const, const utf8_chr *const);
@@ -72,7 +112,8 @@ int utf8_str_cmp(const utf8_chr *const, const utf8_chr *const);
 // On error, sets utf8_lib_error and returns NULL.
 const utf8_chr *utf8_strchr(const utf8_chr *const, utf8_code_pt);
 
-// Checks whether a UTF-8 symbol (as byte pointer) is valid.
+// Checks whether a 0-terminated UTF-8 string is valid, in the same way as
+// utf8_char_valid.
 bool utf8_string_valid(const utf8_chr *const);
 
 int utf8_codepoint_bytes(utf8_code_pt c);
@@ -80,4 +121,143 @@ int utf8_codepoint_bytes(utf8_code_pt c);
 // Get number of bytes in utf8 symbol
 int utf8_num_bytes_in_next_symbol(utf8_chr b, bool set_errno);
 
+// Simple case folding (status C and S in CaseFolding.txt) of a codepoint.
+// Codepoints without a folding are returned as they are.
+utf8_code_pt utf8_casefold_codepoint(utf8_code_pt c);
+
+// Escaping rules for utf8_escape and utf8_unescape.
+// UTF8_ESCAPE_JSON: Contents of a JSON string, without the quotes.
+// UTF8_ESCAPE_C: Contents of a C string literal, without the quotes.
+// UTF8_ESCAPE_SHELL: A complete single-quoted POSIX shell word.
+enum utf8_escape_style {
+  UTF8_ESCAPE_JSON,
+  UTF8_ESCAPE_C,
+  UTF8_ESCAPE_SHELL,
+};
+
+// Number of bytes utf8_escape writes for the first len bytes of s.
+size_t utf8_escaped_size(const utf8_chr *const s, size_t len,
+                         enum utf8_escape_style style);
+
+// Escape the first len bytes of s into dest, which must have room for
+// utf8_escaped_size(s, len, style) bytes. No terminating 0 is written.
+// Symbols outside of ASCII are copied unchanged.
+// Returns the number of bytes written.
+size_t utf8_escape(const utf8_chr *const s, size_t len,
+                   enum utf8_escape_style style, utf8_chr *const dest);
+
+// Undo utf8_escape. dest must have room for len bytes; the output is never
+// longer than the input. \uXXXX (and surrogate pairs in JSON) and
+// \UXXXXXXXX are converted to UTF-8.
+// Returns the number of bytes written or -1 on error.
+ssize_t utf8_unescape(const utf8_chr *const s, size_t len,
+                      enum utf8_escape_style style, utf8_chr *const dest);
+
+// Encodings which differ from UTF-8 in a few symbols.
+// UTF8_VARIANT_STANDARD: UTF-8 without surrogates, overlong forms or
+//   codepoints above U+10FFFF.
+// UTF8_VARIANT_WTF8: UTF-8 which also allows lone surrogates, as found in
+//   Windows file names. A surrogate pair is always written as one symbol.
+// UTF8_VARIANT_CESU8: Codepoints above U+FFFF are written as two 3-byte
+//   surrogates, like UTF-16 would store them.
+// UTF8_VARIANT_MODIFIED: CESU-8 which writes U+0000 as 0xC0 0x80, as used by
+//   Java serialization and JNI.
+enum utf8_variant {
+  UTF8_VARIANT_STANDARD,
+  UTF8_VARIANT_WTF8,
+  UTF8_VARIANT_CESU8,
+  UTF8_VARIANT_MODIFIED,
+};
+
+// Largest number of bytes utf8_transcode writes for len bytes of input when
+// converting to variant to.
+size_t utf8_transcode_bound(size_t len, enum utf8_variant to);
+
+// Convert the first len bytes of s from one variant to another into dest,
+// which must have room for utf8_transcode_bound(len, to) bytes. No
+// terminating 0 is written. Runs of symbols which are the same in both
+// variants, which are all symbols below U+10000 except surrogates and
+// U+0000, are checked and copied as they are.
+// Returns the number of bytes written or -1 on error. utf8_lib_error is
+// INVALID_UTF8_SYMBOL if s is not valid in from, or INVALID_UNICODE_CODEPOINT
+// if a lone surrogate can not be written in to.
+ssize_t utf8_transcode(const utf8_chr *const s, size_t len,
+                       enum utf8_variant from, enum utf8_variant to,
+                       utf8_chr *const dest);
+
+// A string together with facts about it which utf8_span_make finds in one
+// pass, so that later calls answer from them instead of scanning again.
+// ASCII strings take shortcuts in all utf8_span_* functions.
+#define UTF8_SPAN_ASCII 1
+#define UTF8_SPAN_VALID 2
+
+struct utf8_span {
+  const utf8_chr *data;
+  // Number of bytes.
+  size_t len;
+  // Number of codepoints, or SIZE_MAX if the string is invalid.
+  size_t count;
+  // UTF8_SPAN_ASCII and UTF8_SPAN_VALID.
+  unsigned flags;
+};
+
+// Wrap len bytes of s. Invalid UTF-8 is recorded in the flags and does not
+// set utf8_lib_error here.
+struct utf8_span utf8_span_make(const utf8_chr *const s, size_t len);
+
+// Wrap a 0-terminated string.
+struct utf8_span utf8_span_from_cstr(const utf8_chr *const s);
+
+static inline bool utf8_span_valid(const struct utf8_span *const s) {
+  return (s->flags & UTF8_SPAN_VALID) != 0;
+}
+
+static inline bool utf8_span_is_ascii(const struct utf8_span *const s) {
+  return (s->flags & UTF8_SPAN_ASCII) != 0;
+}
+
+// Number of codepoints. On invalid UTF-8, sets utf8_lib_error and returns
+// SIZE_MAX like utf8_strlen.
+static inline size_t utf8_span_strlen(const struct utf8_span *const s) {
+  if (!utf8_span_valid(s))
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+  return s->count;
+}
+
+// Byte offset of codepoint n, or len if there are n codepoints or less.
+// On invalid UTF-8, sets utf8_lib_error and returns SIZE_MAX.
+size_t utf8_span_offset(const struct utf8_span *const s, size_t n);
+
+// The part of s which starts at codepoint start and has up to count
+// codepoints, with its facts. On invalid UTF-8, sets utf8_lib_error and
+// returns an empty span.
+struct utf8_span utf8_span_sub(const struct utf8_span *const s, size_t start,
+                               size_t count);
+
+// First occurrence of a codepoint in s, or NULL. On invalid UTF-8, sets
+// utf8_lib_error and returns NULL.
+const utf8_chr *utf8_span_chr(const struct utf8_span *const s,
+                              utf8_code_pt c);
+
+// Batch versions of utf8_string_valid and utf8_strlen for many short
+// strings of lens[i] bytes each. Pure ASCII strings are recognized 8 bytes
+// at a time; the others are checked four at a time, interleaved, so that the
+// steps of one string do not wait for the ones before.
+// valid[i] is set like utf8_string_valid would return it.
+void utf8_valid_batch(const utf8_chr *const *strs, const size_t *lens,
+                      size_t n, bool *valid);
+
+// counts[i] receives the number of codepoints of strs[i]. For invalid
+// strings, counts[i] is SIZE_MAX and utf8_lib_error is set.
+void utf8_strlen_batch(const utf8_chr *const *strs, const size_t *lens,
+                       size_t n, size_t *counts);
+
+// Number of bytes of a symbol, indexed by its first byte. Invalid first bytes
+// map to 0xFF. utf8.hpp generates the same table at compile time.
+extern const uint8_t utf8_sequence_length_table[256];
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // KL_UTF8_H
@@ -0,0 +1,179 @@
+#ifndef KL_UTF8_HPP
+#define KL_UTF8_HPP
+
+// Compile-time counterparts of the functions in utf8.h.
+// Everything in here is constexpr, so literals can be checked and tables can
+// be generated by the compiler instead of at startup. The functions behave
+// exactly like their C counterparts, with one exception: they never touch
+// utf8_lib_error.
+// Requires C++17. kl::utf8::literal requires C++20.
+
+#include "utf8.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kl {
+namespace utf8 {
+
+// Generate a table of N entries by calling f(0) .. f(N - 1).
+template <typename T, std::size_t N, typename F>
+constexpr std::array<T, N> generate_table(F f) {
+  std::array<T, N> table{};
+  for (std::size_t i = 0; i < N; i++) {
+    table[i] = static_cast<T>(f(i));
+  }
+  return table;
+}
+
+// Same as utf8_sequence_length_table.
+inline constexpr std::array<uint8_t, 256> sequence_length_table =
+    generate_table<uint8_t, 256>([](std::size_t b) {
+      if (b < 0x80)
+        return 1;
+      if (b < 0xC0)
+        return 0xFF; // 10XX_XXXX
+      if (b < 0xE0)
+        return 2;
+      if (b < 0xF0)
+        return 3;
+      if (b < 0xF8)
+        return 4;
+      return 0xFF; // 1111_1XXX
+    });
+
+// See utf8_num_bytes_in_next_symbol. Returns a number above 4 on error.
+constexpr int num_bytes_in_next_symbol(const utf8_chr b) {
+  return sequence_length_table[static_cast<uint8_t>(b)];
+}
+
+// See utf8_codepoint_bytes.
+constexpr int codepoint_bytes(const utf8_code_pt c) {
+  if (c < 0x80) {
+    return 1;
+  } else if (c < 0x0800) {
+    return 2;
+  } else if (c < 0x010000) {
+    return 3;
+  } else if (c < 0x110000) {
+    return 4;
+  }
+  return -1;
+}
+
+// See utf8_from_codepoint. Returns -1 on error.
+constexpr int from_codepoint(const utf8_code_pt c, utf8_chr *const buff) {
+  const int len = codepoint_bytes(c);
+  switch (len) {
+  case 1:
+    buff[0] = static_cast<utf8_chr>(c & 0x7F);
+    break;
+  case 2:
+    buff[0] = static_cast<utf8_chr>(((c >> 6) & 0x1F) | 0xC0);
+    buff[1] = static_cast<utf8_chr>((c & 0x3F) | 0x80);
+    break;
+  case 3:
+    buff[0] = static_cast<utf8_chr>(((c >> 12) & 0x0F) | 0xE0);
+    buff[1] = static_cast<utf8_chr>(((c >> 6) & 0x3F) | 0x80);
+    buff[2] = static_cast<utf8_chr>((c & 0x3F) | 0x80);
+    break;
+  case 4:
+    buff[0] = static_cast<utf8_chr>(((c >> 18) & 0x07) | 0xF0);
+    buff[1] = static_cast<utf8_chr>(((c >> 12) & 0x3F) | 0x80);
+    buff[2] = static_cast<utf8_chr>(((c >> 6) & 0x3F) | 0x80);
+    buff[3] = static_cast<utf8_chr>((c & 0x3F) | 0x80);
+    break;
+  }
+  return len;
+}
+
+// See utf8_to_codepoint. Returns UINT32_MAX on error.
+constexpr utf8_code_pt to_codepoint(const utf8_chr *const b) {
+  const int nbytes = num_bytes_in_next_symbol(b[0]);
+  if (nbytes > 4)
+    return UINT32_MAX;
+  if (nbytes == 1)
+    return static_cast<uint8_t>(b[0]);
+
+  utf8_code_pt c = static_cast<uint8_t>(b[0]) & (0x7F >> nbytes);
+  for (int i = 1; i < nbytes; i++) {
+    if ((static_cast<uint8_t>(b[i]) & 0xC0) != 0x80)
+      return UINT32_MAX;
+    c = (c << 6) | (static_cast<uint8_t>(b[i]) & 0x3F);
+  }
+  return c;
+}
+
+// See utf8_char_valid.
+constexpr bool char_valid(const utf8_chr *const b) {
+  const int len = num_bytes_in_next_symbol(b[0]);
+  if (len > 4)
+    return false;
+  for (int i = 1; i < len; i++) {
+    if ((static_cast<uint8_t>(b[i]) & 0xC0) != 0x80)
+      return false;
+  }
+  return true;
+}
+
+// See utf8_string_valid.
+constexpr bool string_valid(const utf8_chr *const b) {
+  for (std::size_t i = 0; b[i] != 0;) {
+    if (!char_valid(b + i))
+      return false;
+    i += num_bytes_in_next_symbol(b[i]);
+  }
+  return true;
+}
+
+// Encoded form of a single codepoint, terminated by 0.
+//   constexpr auto lambda = kl::utf8::encode<0x03BB>();
+template <utf8_code_pt C> constexpr std::array<utf8_chr, 5> encode() {
+  static_assert(C <= UNICODE_MAX_CODEPT, "Invalid unicode codepoint");
+  std::array<utf8_chr, 5> buff{};
+  from_codepoint(C, buff.data());
+  return buff;
+}
+
+#if __cplusplus >= 202002L
+// A string literal which is validated at compile time. An invalid literal is
+// a compile error.
+//   constexpr kl::utf8::literal s = "λx.x";
+//   puts(s.c_str());
+template <std::size_t N> struct literal {
+  utf8_chr data[N]{};
+
+  consteval literal(const char (&s)[N]) {
+    for (std::size_t i = 0; i < N; i++)
+      data[i] = s[i];
+    check();
+  }
+
+#ifdef __cpp_char8_t
+  consteval literal(const char8_t (&s)[N]) {
+    for (std::size_t i = 0; i < N; i++)
+      data[i] = static_cast<utf8_chr>(s[i]);
+    check();
+  }
+#endif
+
+  constexpr const utf8_chr *c_str() const { return data; }
+
+  // Size in bytes, without the terminating 0.
+  constexpr std::size_t size() const { return N - 1; }
+
+private:
+  consteval void check() const {
+    // Throwing is not allowed during constant evaluation, so this turns an
+    // invalid literal into a compile error.
+    if (!string_valid(data))
+      throw "kl::utf8::literal: invalid UTF-8";
+  }
+};
+#endif
+
+} // namespace utf8
+} // namespace kl
+
+#endif // KL_UTF8_HPP
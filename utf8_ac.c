@@ -0,0 +1,411 @@
+#include "utf8_ac.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Bytes of the form 10XX_XXXX continue a symbol.
+#define IS_CONTINUATION(b) (((uint8_t)(b)&0xC0) == 0x80)
+
+// A state of the automaton. The start state is slot 0.
+struct ac_slot {
+  int32_t base;
+  // Parent of the state in this slot, or -1 if the slot is unused.
+  int32_t check;
+  // Longest proper suffix of this state which is also a state.
+  int32_t fail;
+  // First pattern which ends in this state, or -1.
+  int32_t out;
+  // Next state on the fail chain which has patterns, or -1.
+  int32_t dict;
+};
+
+struct utf8_ac {
+  struct ac_slot *slots;
+  size_t size;
+  size_t *pattern_len;
+  // Next pattern with the same bytes, or -1.
+  int32_t *pattern_next;
+  // Bytes which occur in no pattern are class 0 and have no transitions.
+  uint8_t byte_class[256];
+  // Transitions of the start state for every byte.
+  int32_t root_next[256];
+  // Bytes which can start a match, if there are few of them.
+  int prefilter_len;
+  uint8_t prefilter[3];
+};
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Construction                                            //
+//////////////////////////////////////////////////////////////////////
+
+// While building, the trie is stored with linked lists of edges.
+struct tnode {
+  int32_t first_edge;
+  int32_t fail;
+  int32_t out;
+  int32_t dict;
+  int32_t slot;
+};
+
+struct tedge {
+  int32_t child;
+  int32_t next;
+  uint8_t cls;
+};
+
+struct builder {
+  struct tnode *nodes;
+  size_t nodes_len;
+  size_t nodes_cap;
+  struct tedge *edges;
+  size_t edges_len;
+  size_t edges_cap;
+};
+
+static bool reserve(void **arr, size_t *cap, size_t len, size_t size) {
+  if (len < *cap)
+    return true;
+  const size_t new_cap = *cap ? *cap * 2 : 256;
+  void *temp = realloc(*arr, new_cap * size);
+  if (!temp)
+    return false;
+  *arr = temp;
+  *cap = new_cap;
+  return true;
+}
+
+static int32_t tgoto(const struct builder *b, int32_t node, uint8_t cls) {
+  for (int32_t e = b->nodes[node].first_edge; e >= 0; e = b->edges[e].next) {
+    if (b->edges[e].cls == cls)
+      return b->edges[e].child;
+  }
+  return -1;
+}
+
+static int32_t new_tnode(struct builder *b) {
+  if (!reserve((void **)&b->nodes, &b->nodes_cap, b->nodes_len,
+               sizeof(struct tnode)))
+    return -1;
+  struct tnode *n = &b->nodes[b->nodes_len];
+  n->first_edge = -1;
+  n->fail = 0;
+  n->out = -1;
+  n->dict = -1;
+  n->slot = -1;
+  return (int32_t)b->nodes_len++;
+}
+
+static int32_t add_child(struct builder *b, int32_t node, uint8_t cls) {
+  const int32_t child = new_tnode(b);
+  if (child < 0 || !reserve((void **)&b->edges, &b->edges_cap, b->edges_len,
+                            sizeof(struct tedge)))
+    return -1;
+  struct tedge *e = &b->edges[b->edges_len];
+  e->child = child;
+  e->cls = cls;
+  e->next = b->nodes[node].first_edge;
+  b->nodes[node].first_edge = (int32_t)b->edges_len++;
+  return child;
+}
+
+static bool valid_utf8(const utf8_chr *const s, size_t len) {
+  utf8_code_pt c;
+  for (size_t i = 0; i < len;) {
+    const int n = utf8_decode_next(s + i, len - i, &c);
+    if (n < 1)
+      return false;
+    i += n;
+  }
+  return true;
+}
+
+// Make sure that slots up to n - 1 exist.
+static bool grow_slots(struct utf8_ac *ac, size_t n) {
+  if (n <= ac->size)
+    return true;
+  size_t size = ac->size ? ac->size : 256;
+  while (size < n)
+    size *= 2;
+  struct ac_slot *temp = realloc(ac->slots, size * sizeof(struct ac_slot));
+  if (!temp)
+    return false;
+  for (size_t i = ac->size; i < size; i++) {
+    temp[i].base = 0;
+    temp[i].check = -1;
+    temp[i].fail = 0;
+    temp[i].out = -1;
+    temp[i].dict = -1;
+  }
+  ac->slots = temp;
+  ac->size = size;
+  return true;
+}
+
+// Place the children of every node into free slots, parents first. The
+// children of a node need free slots at base + class for each of their
+// classes.
+static bool place(struct utf8_ac *ac, struct builder *b, const int32_t *order,
+                  size_t count) {
+  size_t first_free = 1;
+  if (!grow_slots(ac, 1))
+    return false;
+  b->nodes[0].slot = 0;
+  ac->slots[0].check = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    const struct tnode *n = &b->nodes[order[i]];
+    if (n->first_edge < 0)
+      continue;
+    int min_cls = 256, max_cls = 0;
+    for (int32_t e = n->first_edge; e >= 0; e = b->edges[e].next) {
+      if (b->edges[e].cls < min_cls)
+        min_cls = b->edges[e].cls;
+      if (b->edges[e].cls > max_cls)
+        max_cls = b->edges[e].cls;
+    }
+
+    while (first_free < ac->size && ac->slots[first_free].check >= 0)
+      first_free++;
+    int64_t base = (int64_t)first_free - min_cls;
+    for (;; base++) {
+      if (!grow_slots(ac, (size_t)(base + max_cls + 1)))
+        return false;
+      bool free_slots = base + min_cls >= 1;
+      for (int32_t e = n->first_edge; free_slots && e >= 0;
+           e = b->edges[e].next)
+        free_slots = ac->slots[base + b->edges[e].cls].check < 0;
+      if (free_slots)
+        break;
+    }
+    if (base + max_cls > INT32_MAX)
+      return false;
+
+    ac->slots[n->slot].base = (int32_t)base;
+    for (int32_t e = n->first_edge; e >= 0; e = b->edges[e].next) {
+      const int32_t slot = (int32_t)base + b->edges[e].cls;
+      ac->slots[slot].check = n->slot;
+      b->nodes[b->edges[e].child].slot = slot;
+    }
+  }
+  return true;
+}
+
+struct utf8_ac *utf8_ac_build(const utf8_chr *const *patterns,
+                              const size_t *lens, size_t n) {
+  struct utf8_ac *ac = calloc(1, sizeof(struct utf8_ac));
+  struct builder b = {0};
+  int32_t *order = NULL;
+  bool ok = false;
+  if (!ac)
+    return NULL;
+  ac->pattern_len = malloc((n ? n : 1) * sizeof(size_t));
+  ac->pattern_next = malloc((n ? n : 1) * sizeof(int32_t));
+  if (!ac->pattern_len || !ac->pattern_next || n >= INT32_MAX)
+    goto done;
+
+  bool used[256] = {false};
+  for (size_t i = 0; i < n; i++) {
+    if (lens[i] == 0) {
+      set_utf8_lib_error(INVALID_PATTERN);
+      goto done;
+    }
+    if (!valid_utf8(patterns[i], lens[i])) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      goto done;
+    }
+    for (size_t j = 0; j < lens[i]; j++)
+      used[(uint8_t)patterns[i][j]] = true;
+  }
+  uint8_t classes = 0;
+  for (int c = 0; c < 256; c++)
+    ac->byte_class[c] = used[c] ? ++classes : 0;
+
+  // Trie of all patterns.
+  if (new_tnode(&b) < 0)
+    goto done;
+  for (size_t i = 0; i < n; i++) {
+    int32_t node = 0;
+    for (size_t j = 0; j < lens[i]; j++) {
+      const uint8_t cls = ac->byte_class[(uint8_t)patterns[i][j]];
+      int32_t child = tgoto(&b, node, cls);
+      if (child < 0 && (child = add_child(&b, node, cls)) < 0)
+        goto done;
+      node = child;
+    }
+    // Keep patterns with the same bytes in order.
+    ac->pattern_len[i] = lens[i];
+    ac->pattern_next[i] = -1;
+    int32_t *link = &b.nodes[node].out;
+    while (*link >= 0)
+      link = &ac->pattern_next[*link];
+    *link = (int32_t)i;
+  }
+
+  // Fail and dictionary links in breadth first order, which is also the
+  // order in which the nodes are placed.
+  order = malloc(b.nodes_len * sizeof(int32_t));
+  if (!order)
+    goto done;
+  size_t head = 0, tail = 0;
+  order[tail++] = 0;
+  while (head < tail) {
+    const int32_t u = order[head++];
+    for (int32_t e = b.nodes[u].first_edge; e >= 0; e = b.edges[e].next) {
+      const int32_t v = b.edges[e].child;
+      const uint8_t cls = b.edges[e].cls;
+      int32_t f = b.nodes[u].fail;
+      int32_t target = -1;
+      if (u != 0) {
+        while ((target = tgoto(&b, f, cls)) < 0 && f != 0)
+          f = b.nodes[f].fail;
+      }
+      b.nodes[v].fail = target < 0 ? 0 : target;
+      const struct tnode *fn = &b.nodes[b.nodes[v].fail];
+      b.nodes[v].dict = fn->out >= 0 ? b.nodes[v].fail : fn->dict;
+      order[tail++] = v;
+    }
+  }
+
+  if (!place(ac, &b, order, tail))
+    goto done;
+  for (size_t i = 0; i < b.nodes_len; i++) {
+    struct ac_slot *s = &ac->slots[b.nodes[i].slot];
+    s->fail = b.nodes[b.nodes[i].fail].slot;
+    s->out = b.nodes[i].out;
+    s->dict = b.nodes[i].dict < 0 ? -1 : b.nodes[b.nodes[i].dict].slot;
+  }
+
+  ac->prefilter_len = 0;
+  for (int c = 0; c < 256; c++) {
+    const int32_t child = ac->byte_class[c] == 0
+                              ? -1
+                              : tgoto(&b, 0, ac->byte_class[c]);
+    ac->root_next[c] = child < 0 ? 0 : b.nodes[child].slot;
+    if (child >= 0) {
+      if (ac->prefilter_len < 3)
+        ac->prefilter[ac->prefilter_len] = (uint8_t)c;
+      ac->prefilter_len++;
+    }
+  }
+  if (ac->prefilter_len > 3)
+    ac->prefilter_len = 0;
+  ok = true;
+
+done:
+  free(b.nodes);
+  free(b.edges);
+  free(order);
+  if (!ok) {
+    utf8_ac_free(ac);
+    return NULL;
+  }
+  return ac;
+}
+
+void utf8_ac_free(struct utf8_ac *ac) {
+  if (!ac)
+    return;
+  free(ac->slots);
+  free(ac->pattern_len);
+  free(ac->pattern_next);
+  free(ac);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Search                                                  //
+//////////////////////////////////////////////////////////////////////
+
+static utf8_inline int32_t step(const struct utf8_ac *ac, int32_t s,
+                                uint8_t byte) {
+  const uint8_t cls = ac->byte_class[byte];
+  if (cls == 0)
+    return 0;
+  for (;;) {
+    if (s == 0)
+      return ac->root_next[byte];
+    const int64_t t = (int64_t)ac->slots[s].base + cls;
+    if (t > 0 && (size_t)t < ac->size && ac->slots[t].check == s)
+      return (int32_t)t;
+    s = ac->slots[s].fail;
+  }
+}
+
+// Offset of the next byte from pos on which can start a match.
+static size_t skip_to_start(const struct utf8_ac *ac, const uint8_t *s,
+                            size_t pos, size_t len) {
+#if defined(__SSE2__)
+  if (ac->prefilter_len == 0)
+    return pos;
+  const __m128i v0 = _mm_set1_epi8((char)ac->prefilter[0]);
+  const __m128i v1 =
+      _mm_set1_epi8((char)ac->prefilter[ac->prefilter_len > 1 ? 1 : 0]);
+  const __m128i v2 =
+      _mm_set1_epi8((char)ac->prefilter[ac->prefilter_len > 2 ? 2 : 0]);
+  for (; pos + 16 <= len; pos += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i *)(s + pos));
+    const __m128i eq =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, v0), _mm_cmpeq_epi8(x, v1)),
+                     _mm_cmpeq_epi8(x, v2));
+    const int mask = _mm_movemask_epi8(eq);
+    if (mask != 0)
+      return pos + __builtin_ctz(mask);
+  }
+#else
+  (void)ac;
+  (void)s;
+  (void)len;
+#endif
+  return pos;
+}
+
+void utf8_ac_iter_init(struct utf8_ac_iter *it, const struct utf8_ac *ac,
+                       const utf8_chr *const text, size_t len) {
+  it->ac = ac;
+  it->text = text;
+  it->len = len;
+  it->pos = 0;
+  it->state = 0;
+  it->out_state = -1;
+  it->out_pattern = -1;
+}
+
+bool utf8_ac_next(struct utf8_ac_iter *it, struct utf8_ac_match *m) {
+  const struct utf8_ac *ac = it->ac;
+  const uint8_t *const s = (const uint8_t *)it->text;
+
+  for (;;) {
+    while (it->out_state >= 0) {
+      if (it->out_pattern < 0) {
+        it->out_state = ac->slots[it->out_state].dict;
+        if (it->out_state >= 0)
+          it->out_pattern = ac->slots[it->out_state].out;
+        continue;
+      }
+      const int32_t p = it->out_pattern;
+      it->out_pattern = ac->pattern_next[p];
+      m->pattern = (size_t)p;
+      m->start = it->pos - ac->pattern_len[p];
+      m->end = it->pos;
+      return true;
+    }
+
+    if (it->state == 0)
+      it->pos = skip_to_start(ac, s, it->pos, it->len);
+    if (it->pos >= it->len)
+      return false;
+    it->state = step(ac, it->state, s[it->pos++]);
+
+    // Patterns are valid UTF-8, so a match always starts at the first byte
+    // of a symbol. It must not end inside of one either.
+    if (it->pos < it->len && IS_CONTINUATION(s[it->pos]))
+      continue;
+    const struct ac_slot *slot = &ac->slots[it->state];
+    it->out_state = slot->out >= 0 ? it->state : slot->dict;
+    if (it->out_state >= 0)
+      it->out_pattern = ac->slots[it->out_state].out;
+  }
+}
@@ -0,0 +1,75 @@
+#ifndef KL_UTF8_AC_H
+#define KL_UTF8_AC_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Aho-Corasick automaton which finds any number of patterns in one pass over
+// UTF-8 text. It works on bytes, so the text is never decoded.
+//
+// The trie is stored as a double array: the child of state s for byte class
+// c is state base[s] + c if check[base[s] + c] == s. This keeps a state's
+// transitions next to each other without storing a full row per state.
+// While the automaton is in its start state, text which can not start a
+// match is skipped with SSE2 if at most 3 bytes can start a pattern.
+//
+// Matches are reported only if they start and end at symbol boundaries, so a
+// pattern never matches part of a symbol, even in invalid text.
+//
+//   struct utf8_ac *ac = utf8_ac_build(patterns, lens, n);
+//   struct utf8_ac_iter it;
+//   struct utf8_ac_match m;
+//   utf8_ac_iter_init(&it, ac, text, len);
+//   while (utf8_ac_next(&it, &m))
+//     printf("Pattern %zu at %zu..%zu\n", m.pattern, m.start, m.end);
+//   utf8_ac_free(ac);
+
+struct utf8_ac;
+
+struct utf8_ac_match {
+  // Index of the pattern in the array passed to utf8_ac_build.
+  size_t pattern;
+  // Byte offsets of the match. end is the first byte after it.
+  size_t start;
+  size_t end;
+};
+
+struct utf8_ac_iter {
+  const struct utf8_ac *ac;
+  const utf8_chr *text;
+  size_t len;
+  // Offset of the next byte.
+  size_t pos;
+  int32_t state;
+  // Matches ending at pos which were not returned yet: the state whose
+  // patterns are reported and the next of its patterns.
+  int32_t out_state;
+  int32_t out_pattern;
+};
+
+// Build an automaton for n patterns. Patterns are copied and need not stay
+// valid. The same pattern may be passed more than once.
+// Returns NULL on error. Sets utf8_lib_error to INVALID_UTF8_SYMBOL if a
+// pattern is not valid UTF-8, or to INVALID_PATTERN if one is empty. Failed
+// memory allocation does not set utf8_lib_error.
+struct utf8_ac *utf8_ac_build(const utf8_chr *const *patterns,
+                              const size_t *lens, size_t n);
+
+void utf8_ac_free(struct utf8_ac *ac);
+
+void utf8_ac_iter_init(struct utf8_ac_iter *it, const struct utf8_ac *ac,
+                       const utf8_chr *const text, size_t len);
+
+// Find the next match, including overlapping ones. Matches are returned in
+// the order of their end offsets; matches with the same end come longest
+// first. Returns false if there are no more matches.
+bool utf8_ac_next(struct utf8_ac_iter *it, struct utf8_ac_match *m);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_AC_H
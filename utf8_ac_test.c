@@ -0,0 +1,147 @@
+#include "utest/utest.h"
+#include "utf8_ac.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+static struct utf8_ac *build(const char **patterns, size_t n) {
+  size_t lens[64];
+  for (size_t i = 0; i < n; i++)
+    lens[i] = strlen(patterns[i]);
+  return utf8_ac_build((const utf8_chr *const *)patterns, lens, n);
+}
+
+UTEST(utf8_ac, classic) {
+  const char *patterns[] = {"he", "she", "his", "hers"};
+  struct utf8_ac *ac = build(patterns, 4);
+  ASSERT_TRUE(ac != NULL);
+
+  const size_t expected[][3] = {{1, 1, 4}, {0, 2, 4}, {3, 2, 6}};
+  struct utf8_ac_iter it;
+  struct utf8_ac_match m;
+  utf8_ac_iter_init(&it, ac, U8("ushers"), 6);
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_TRUE(utf8_ac_next(&it, &m));
+    ASSERT_EQ(m.pattern, expected[i][0]);
+    ASSERT_EQ(m.start, expected[i][1]);
+    ASSERT_EQ(m.end, expected[i][2]);
+  }
+  ASSERT_FALSE(utf8_ac_next(&it, &m));
+  utf8_ac_free(ac);
+}
+
+UTEST(utf8_ac, boundaries) {
+  // "λ", "€", "λ" again and ASCII.
+  const char *patterns[] = {"\xCE\xBB", "\xE2\x82\xAC", "\xCE\xBB", "x"};
+  struct utf8_ac *ac = build(patterns, 4);
+  struct utf8_ac_iter it;
+  struct utf8_ac_match m;
+
+  const char *text = "x\xCE\xBB\xE2\x82\xAC";
+  utf8_ac_iter_init(&it, ac, U8(text), strlen(text));
+  ASSERT_TRUE(utf8_ac_next(&it, &m));
+  ASSERT_EQ(m.pattern, (size_t)3);
+  ASSERT_TRUE(utf8_ac_next(&it, &m));
+  ASSERT_EQ(m.pattern, (size_t)0);
+  ASSERT_EQ(m.start, (size_t)1);
+  ASSERT_TRUE(utf8_ac_next(&it, &m));
+  ASSERT_EQ(m.pattern, (size_t)2);
+  ASSERT_TRUE(utf8_ac_next(&it, &m));
+  ASSERT_EQ(m.pattern, (size_t)1);
+  ASSERT_EQ(m.end, strlen(text));
+  ASSERT_FALSE(utf8_ac_next(&it, &m));
+
+  // A pattern followed by a stray continuation byte is part of an invalid
+  // symbol and does not match.
+  utf8_ac_iter_init(&it, ac, U8("\xCE\xBB\x80x"), 4);
+  ASSERT_TRUE(utf8_ac_next(&it, &m));
+  ASSERT_EQ(m.pattern, (size_t)3);
+  ASSERT_FALSE(utf8_ac_next(&it, &m));
+  utf8_ac_free(ac);
+}
+
+UTEST(utf8_ac, errors) {
+  const char *empty[] = {"a", ""};
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(build(empty, 2) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_PATTERN);
+
+  const char *invalid[] = {"a", "\xCE"};
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(build(invalid, 2) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+
+  // No patterns at all never match.
+  struct utf8_ac *ac = build(NULL, 0);
+  struct utf8_ac_iter it;
+  struct utf8_ac_match m;
+  ASSERT_TRUE(ac != NULL);
+  utf8_ac_iter_init(&it, ac, U8("abc"), 3);
+  ASSERT_FALSE(utf8_ac_next(&it, &m));
+  utf8_ac_free(ac);
+}
+
+// Compare with a naive search over random text, with few and with many
+// distinct first bytes, so that the search runs with and without prefilter.
+static int compare_naive(const char **symbols, size_t symbols_n,
+                         unsigned seed) {
+  char patterns[64][16];
+  const char *pattern_ptrs[64];
+  size_t lens[64];
+  char text[2000];
+  size_t len = 0;
+  int errors = 0;
+
+  for (size_t i = 0; i < 64; i++) {
+    seed = seed * 1103515245 + 12345;
+    const unsigned n = 1 + (seed >> 16) % 3;
+    lens[i] = 0;
+    for (unsigned j = 0; j < n; j++) {
+      seed = seed * 1103515245 + 12345;
+      const char *sym = symbols[(seed >> 16) % symbols_n];
+      memcpy(patterns[i] + lens[i], sym, strlen(sym));
+      lens[i] += strlen(sym);
+    }
+    pattern_ptrs[i] = patterns[i];
+  }
+  while (len + 8 < sizeof(text)) {
+    seed = seed * 1103515245 + 12345;
+    const char *sym = symbols[(seed >> 16) % symbols_n];
+    if ((seed >> 8) % 7 == 0)
+      sym = "-----";
+    memcpy(text + len, sym, strlen(sym));
+    len += strlen(sym);
+  }
+
+  struct utf8_ac *ac =
+      utf8_ac_build((const utf8_chr *const *)pattern_ptrs, lens, 64);
+  struct utf8_ac_iter it;
+  struct utf8_ac_match m;
+  size_t found = 0, expected = 0;
+  utf8_ac_iter_init(&it, ac, U8(text), len);
+  while (utf8_ac_next(&it, &m)) {
+    found++;
+    if (m.end - m.start != lens[m.pattern] ||
+        memcmp(text + m.start, patterns[m.pattern], lens[m.pattern]) != 0)
+      errors++;
+  }
+  for (size_t i = 0; i < 64; i++) {
+    for (size_t pos = 0; pos + lens[i] <= len; pos++)
+      expected += memcmp(text + pos, patterns[i], lens[i]) == 0;
+  }
+  utf8_ac_free(ac);
+  return errors + (found != expected);
+}
+
+UTEST(utf8_ac, naive) {
+  const char *few[] = {"a", "\xCE\xBB", "\xCE\xBC", "ab"};
+  const char *many[] = {"a", "b", "c", "\xCE\xBB", "\xE2\x82\xAC",
+                        "\xF0\x9F\x98\x80", "\xD0\x96"};
+  for (unsigned seed = 1; seed < 20; seed++) {
+    ASSERT_EQ(compare_naive(few, 4, seed), 0);
+    ASSERT_EQ(compare_naive(many, 7, seed), 0);
+  }
+}
+
+UTEST_MAIN()
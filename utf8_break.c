@@ -0,0 +1,1527 @@
+#include "utf8_break.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Word_Break values (UAX #29). Extended_Pictographic is a separate bit.
+enum word_class {
+  WB_OTHER,
+  WB_CR,
+  WB_LF,
+  WB_NEWLINE,
+  WB_EXTEND,
+  WB_ZWJ,
+  WB_REGIONAL_INDICATOR,
+  WB_FORMAT,
+  WB_KATAKANA,
+  WB_HEBREW_LETTER,
+  WB_ALETTER,
+  WB_SINGLE_QUOTE,
+  WB_DOUBLE_QUOTE,
+  WB_MIDNUMLET,
+  WB_MIDLETTER,
+  WB_MIDNUM,
+  WB_NUMERIC,
+  WB_EXTENDNUMLET,
+  WB_WSEGSPACE,
+};
+
+// Line_Break values (UAX #14) after the resolution of rule LB1: AI, SG and XX
+// are AL, SA is CM or AL, CJ is NS. OPW and CPW are East Asian OP and CP,
+// which are excluded from rule LB30.
+enum line_class {
+  LB_BK, LB_CR, LB_LF, LB_NL, LB_SP, LB_ZW, LB_CM, LB_ZWJ, LB_WJ, LB_GL,
+  LB_BA, LB_BB, LB_B2, LB_HY, LB_CB, LB_CL, LB_CP, LB_EX, LB_IN, LB_NS,
+  LB_OP, LB_QU, LB_IS, LB_NU, LB_PO, LB_PR, LB_SY, LB_AL, LB_HL, LB_ID,
+  LB_EB, LB_EM, LB_H2, LB_H3, LB_JL, LB_JV, LB_JT, LB_RI, LB_OPW, LB_CPW,
+  LB_COUNT
+};
+
+// Break properties of all codepoints as a three-stage table. Each entry holds
+// the word class in bits 0..4, the line class in bits 5..10 and
+// Extended_Pictographic in bit 11.
+// Generated from the Unicode 14.0 character database.
+static const uint8_t break_stage1[4352] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 1,
+    21, 22, 23, 24, 25, 26, 27, 28, 1, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 38, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 51, 52, 52, 52, 53, 1, 54, 55, 56, 57, 58, 59, 60, 61,
+    62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66,
+    60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64,
+    65, 66, 60, 67, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 49,
+    49, 68, 1, 69, 70, 71, 72, 73, 74, 75, 76, 77, 1, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 38, 98, 99, 100,
+    101, 1, 1, 1, 102, 103, 104, 38, 38, 38, 38, 38, 38, 38, 38, 38, 105, 1, 1,
+    106, 107, 108, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    1, 109, 110, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 1, 1,
+    111, 112, 38, 38, 113, 114, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 115, 49, 49, 49, 38, 38, 116,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 117, 118, 119, 120,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 121, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 122, 38, 123, 124, 38, 125, 126, 127,
+    128, 38, 38, 129, 38, 38, 38, 38, 130, 131, 132, 133, 38, 38, 38, 38, 134,
+    135, 136, 38, 38, 137, 38, 138, 38, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 139, 139, 139, 151, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 152,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 152, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 153, 154, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38
+};
+
+static const uint16_t break_stage2[4960] = {
+    0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 7, 8, 6, 7, 7, 9, 10, 0, 0, 0, 11, 12, 13, 14,
+    7, 7, 15, 7, 7, 7, 15, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 16, 7, 17, 7, 7, 7, 7, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 19, 18, 20, 21, 18, 22, 23, 24, 25, 7, 7, 26, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 27, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 28, 29, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 7,
+    7, 7, 15, 30, 7, 7, 7, 7, 7, 31, 32, 18, 18, 18, 18, 33, 34, 35, 36, 36, 36,
+    37, 38, 35, 39, 40, 18, 41, 7, 7, 7, 7, 7, 42, 18, 18, 4, 43, 44, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 45, 46, 47, 48, 4, 49, 35, 50, 51, 7, 7, 7, 18, 18,
+    18, 52, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 53, 18, 54, 35, 4, 55, 7, 7, 7, 42,
+    56, 57, 7, 7, 53, 58, 59, 60, 35, 35, 7, 7, 7, 61, 7, 62, 7, 7, 7, 63, 64,
+    18, 7, 7, 7, 7, 7, 65, 18, 18, 66, 18, 18, 18, 67, 7, 7, 7, 7, 7, 7, 68, 18,
+    18, 69, 7, 70, 4, 6, 7, 71, 72, 73, 7, 7, 74, 75, 76, 77, 78, 79, 80, 81, 4,
+    82, 83, 84, 85, 73, 7, 7, 74, 86, 87, 88, 89, 90, 91, 92, 4, 93, 35, 84, 27,
+    26, 7, 7, 74, 94, 76, 95, 96, 97, 35, 81, 4, 98, 99, 84, 72, 73, 7, 7, 74,
+    94, 76, 77, 89, 100, 80, 81, 4, 101, 35, 102, 103, 104, 105, 106, 103, 7,
+    107, 108, 109, 110, 35, 92, 4, 35, 98, 111, 22, 74, 7, 7, 74, 7, 76, 112,
+    109, 113, 114, 81, 4, 115, 35, 116, 22, 74, 7, 7, 74, 117, 76, 112, 109,
+    113, 118, 81, 4, 119, 35, 67, 22, 74, 7, 7, 7, 7, 120, 112, 121, 122, 123,
+    81, 4, 35, 124, 84, 7, 15, 125, 7, 7, 26, 126, 15, 127, 128, 18, 92, 4, 129,
+    35, 35, 35, 35, 35, 35, 35, 130, 131, 79, 132, 4, 133, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 130, 134, 35, 135, 4, 136, 35, 35, 35, 35, 137, 138,
+    139, 140, 4, 136, 141, 142, 7, 6, 7, 7, 7, 143, 32, 144, 145, 146, 18, 32,
+    18, 18, 18, 147, 148, 35, 149, 150, 35, 35, 35, 35, 35, 35, 35, 35, 35, 151,
+    18, 132, 4, 133, 152, 153, 154, 135, 155, 35, 156, 95, 4, 157, 7, 7, 7, 7,
+    27, 158, 7, 7, 7, 7, 7, 159, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 162, 162, 7, 7, 7, 7, 7, 7, 7, 7, 7, 104, 15,
+    104, 7, 7, 7, 7, 7, 104, 7, 7, 7, 7, 104, 15, 104, 7, 15, 7, 7, 7, 7, 7, 7,
+    7, 104, 7, 7, 7, 7, 7, 7, 7, 7, 163, 164, 35, 35, 35, 7, 7, 35, 35, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 165, 165, 166, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 72, 7, 7, 167, 7, 7, 168, 7, 7, 7, 7, 7, 7, 7, 7, 7, 169,
+    7, 97, 7, 7, 170, 123, 7, 7, 171, 35, 7, 7, 172, 35, 7, 22, 173, 35, 35, 35,
+    35, 35, 35, 35, 174, 18, 18, 18, 175, 176, 4, 136, 35, 35, 177, 178, 4, 136,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 97, 179, 7, 7, 7, 7, 180, 7, 7, 7, 7, 7, 7,
+    7, 7, 165, 35, 7, 7, 7, 15, 18, 181, 18, 181, 182, 4, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 4, 136, 35, 35, 35, 35, 7, 7,
+    183, 181, 35, 35, 35, 35, 35, 35, 100, 132, 18, 18, 18, 77, 4, 136, 4, 136,
+    35, 35, 18, 18, 18, 132, 35, 35, 35, 35, 35, 35, 111, 7, 7, 7, 7, 7, 184,
+    18, 111, 143, 4, 185, 186, 151, 181, 187, 188, 7, 7, 7, 69, 189, 4, 55, 7,
+    7, 7, 7, 53, 18, 181, 35, 7, 7, 7, 7, 184, 18, 18, 190, 4, 191, 4, 55, 7, 7,
+    7, 192, 7, 97, 7, 7, 7, 7, 7, 193, 35, 35, 194, 18, 18, 195, 196, 197, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 18, 18,
+    18, 18, 18, 18, 18, 18, 7, 7, 165, 165, 7, 7, 7, 7, 165, 165, 7, 198, 7, 7,
+    7, 165, 7, 7, 7, 7, 7, 7, 22, 199, 200, 143, 201, 202, 7, 143, 200, 203,
+    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 101,
+    218, 35, 219, 7, 143, 220, 221, 222, 223, 224, 221, 18, 18, 18, 18, 225, 35,
+    226, 124, 227, 228, 229, 230, 7, 231, 232, 233, 35, 35, 7, 7, 7, 7, 7, 97,
+    234, 235, 35, 236, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 237, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 238, 35, 35, 35, 239, 35, 240, 35, 241, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 242, 35, 35, 35, 35, 35, 35, 35, 243, 35,
+    35, 35, 244, 245, 246, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 247, 7, 248, 7, 7, 7, 7, 249, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 250, 251, 35, 242, 35, 35, 35, 35, 35, 35, 252, 253, 254, 255, 256,
+    254, 254, 254, 257, 254, 254, 254, 254, 254, 258, 254, 259, 260, 35, 254,
+    254, 254, 254, 254, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 242, 275, 35, 276, 277, 278, 279, 280, 281, 282, 35, 35, 35,
+    283, 35, 274, 35, 242, 243, 219, 35, 35, 35, 284, 281, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 285, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 286, 287, 287, 288, 35, 35, 35, 35, 35, 35, 35,
+    239, 35, 35, 35, 289, 283, 35, 35, 275, 35, 35, 35, 35, 35, 35, 290, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 143, 291, 292, 293, 7, 7, 7, 7, 27, 158, 7, 7, 7, 7, 7, 7, 7, 123,
+    186, 79, 7, 7, 15, 35, 15, 15, 15, 15, 15, 15, 15, 15, 18, 18, 18, 18, 294,
+    295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 35, 35, 35, 35, 306,
+    306, 306, 307, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 308, 35,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 309, 35, 35, 35, 306,
+    308, 310, 311, 312, 313, 306, 314, 315, 316, 317, 318, 306, 306, 319, 306,
+    306, 306, 320, 321, 322, 323, 324, 325, 326, 326, 327, 326, 326, 326, 328,
+    329, 330, 331, 332, 333, 333, 333, 333, 333, 334, 333, 333, 333, 333, 333,
+    333, 333, 333, 333, 333, 335, 306, 306, 333, 333, 333, 333, 306, 306, 306,
+    306, 308, 35, 336, 336, 306, 306, 306, 337, 306, 306, 306, 306, 306, 35,
+    306, 306, 306, 306, 306, 306, 306, 306, 338, 339, 306, 306, 306, 306, 306,
+    306, 326, 326, 326, 326, 326, 340, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 35, 35, 35, 35, 35, 35, 35, 35, 333, 333, 341, 333,
+    333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 333, 342, 306, 306, 306, 306, 306, 306, 337, 35, 7, 7, 7, 7, 7, 192, 7,
+    343, 7, 7, 4, 344, 35, 35, 7, 7, 7, 7, 7, 183, 194, 345, 7, 7, 7, 53, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 346, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 62, 347, 249, 35, 35, 125, 7, 348, 349, 7,
+    7, 42, 350, 35, 351, 7, 7, 7, 7, 7, 7, 352, 35, 29, 7, 7, 7, 7, 7, 184, 18,
+    135, 353, 4, 136, 18, 18, 29, 354, 4, 55, 7, 7, 53, 355, 7, 7, 183, 18, 181,
+    35, 160, 160, 160, 356, 67, 7, 7, 7, 7, 7, 42, 18, 357, 358, 4, 136, 359,
+    35, 4, 136, 7, 7, 7, 7, 7, 69, 132, 35, 349, 360, 4, 361, 35, 35, 35, 362,
+    35, 35, 35, 35, 35, 35, 154, 363, 90, 35, 35, 35, 7, 42, 364, 35, 63, 63,
+    63, 35, 15, 15, 7, 7, 7, 7, 7, 7, 7, 249, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 42, 365, 4, 136, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367,
+    368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368,
+    367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367,
+    367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367,
+    367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367,
+    366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366,
+    367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367,
+    367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367,
+    368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368,
+    367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367,
+    367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367,
+    367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367,
+    366, 367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366,
+    367, 367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367,
+    367, 368, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366, 367, 367,
+    368, 367, 367, 367, 367, 367, 367, 366, 367, 367, 368, 367, 367, 367, 366,
+    367, 367, 368, 367, 367, 367, 366, 367, 367, 369, 35, 161, 161, 370, 371,
+    162, 162, 162, 162, 162, 372, 15, 35, 373, 374, 36, 375, 376, 377, 378, 36,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 249, 35, 35, 35, 373, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 379, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 125, 7, 7, 7, 7, 7,
+    7, 35, 35, 35, 35, 35, 7, 380, 18, 18, 381, 382, 18, 18, 383, 384, 385, 386,
+    387, 388, 337, 389, 22, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 390,
+    391, 392, 393, 394, 395, 333, 333, 396, 395, 333, 333, 397, 398, 336, 399,
+    326, 326, 326, 326, 400, 333, 333, 333, 335, 401, 401, 401, 402, 403, 35,
+    35, 404, 7, 117, 7, 7, 15, 7, 7, 405, 7, 165, 7, 165, 35, 35, 35, 35, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 62, 406, 35, 35, 35, 35, 35, 35, 35,
+    7, 7, 7, 7, 7, 7, 143, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 359, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 7, 7, 7, 143, 7, 7, 7, 7, 7, 7, 97, 35, 225, 35, 35, 35, 7, 7, 7, 7, 35,
+    232, 7, 7, 7, 62, 7, 7, 7, 7, 53, 407, 7, 7, 7, 408, 7, 7, 7, 7, 202, 7,
+    409, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 165, 4, 136, 7, 7, 7, 7, 202, 7, 7, 7, 7, 202, 7, 7, 7, 7, 7, 35, 7,
+    7, 7, 7, 7, 7, 202, 35, 7, 159, 7, 159, 405, 7, 26, 7, 26, 410, 35, 35, 35,
+    35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 15, 35, 7, 7, 165, 35, 7, 35, 35, 35,
+    27, 7, 7, 7, 7, 7, 74, 62, 35, 35, 35, 35, 35, 35, 35, 35, 165, 74, 7, 7, 7,
+    7, 27, 411, 7, 7, 408, 35, 7, 7, 15, 35, 7, 7, 7, 15, 35, 35, 35, 35, 35,
+    35, 35, 35, 7, 7, 412, 35, 7, 7, 165, 413, 7, 7, 7, 249, 35, 35, 35, 35, 35,
+    35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 247, 35, 35, 35, 35, 35, 35, 35, 35, 414,
+    174, 117, 6, 7, 7, 165, 88, 35, 35, 415, 35, 7, 7, 7, 143, 7, 7, 7, 143, 35,
+    35, 35, 35, 7, 6, 7, 7, 416, 35, 417, 35, 7, 7, 7, 7, 7, 7, 165, 418, 7, 7,
+    165, 35, 7, 7, 62, 35, 7, 7, 249, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 97, 35, 35, 35, 35, 35, 35, 7, 7, 7,
+    7, 7, 7, 62, 35, 7, 7, 7, 7, 7, 7, 62, 35, 7, 7, 7, 7, 184, 35, 4, 136, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 7, 7, 7, 7, 7, 419, 249, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7,
+    143, 123, 35, 7, 7, 53, 18, 225, 35, 35, 35, 7, 7, 170, 35, 35, 35, 35, 35,
+    7, 7, 143, 35, 35, 35, 7, 7, 15, 35, 188, 7, 7, 7, 7, 7, 7, 18, 420, 186,
+    35, 35, 92, 4, 421, 79, 188, 7, 7, 7, 7, 7, 18, 422, 423, 424, 7, 7, 7, 97,
+    4, 136, 188, 7, 7, 7, 183, 18, 425, 4, 426, 35, 7, 7, 7, 7, 427, 35, 188, 7,
+    7, 7, 7, 7, 42, 18, 428, 429, 4, 430, 35, 35, 35, 35, 7, 7, 26, 7, 7, 184,
+    18, 431, 35, 35, 35, 35, 35, 35, 35, 35, 15, 230, 7, 27, 7, 432, 7, 7, 7, 7,
+    7, 183, 18, 407, 4, 136, 433, 72, 73, 7, 7, 74, 94, 434, 77, 89, 110, 232,
+    435, 134, 134, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 7, 7, 7, 7, 7, 7, 146, 18, 436, 437, 4, 438, 249, 35, 35, 35, 7, 7,
+    7, 7, 7, 7, 18, 18, 439, 35, 4, 136, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 183, 135, 18, 440,
+    418, 415, 360, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 18, 18, 441, 35, 4, 136,
+    442, 443, 35, 35, 7, 7, 7, 7, 7, 42, 18, 97, 4, 136, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 100, 18, 181, 4, 444, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 184,
+    18, 407, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7,
+    7, 7, 4, 136, 35, 123, 15, 445, 446, 7, 7, 7, 95, 447, 448, 35, 4, 136, 35,
+    35, 35, 35, 35, 35, 35, 35, 7, 125, 7, 7, 7, 7, 69, 156, 449, 35, 35, 35,
+    69, 188, 7, 7, 7, 7, 42, 450, 451, 35, 69, 67, 7, 7, 7, 7, 7, 65, 18, 452,
+    453, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 97, 7, 74, 7, 7, 7, 183, 132, 18, 454,
+    35, 4, 136, 35, 35, 455, 7, 7, 7, 156, 18, 18, 32, 132, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 15, 26, 7, 7, 7, 7, 456, 457, 458, 35, 4, 136, 27, 74, 7, 7,
+    7, 459, 460, 97, 4, 136, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 7, 7, 461, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97, 35, 35, 35, 35, 462,
+    351, 35, 35, 413, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    249, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 15, 463, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 202, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    97, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 464, 7, 7, 7, 7, 465, 466, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 467, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 15,
+    468, 469, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 470, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    15, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 97, 7, 7, 7, 15, 4, 471, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 15, 4, 136, 7, 7, 7, 165, 472, 35, 7, 7, 7, 7, 7, 7, 420,
+    473, 474, 35, 4, 136, 373, 7, 7, 232, 7, 7, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7,
+    7, 35, 35, 413, 186, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 475, 69, 18, 18, 18, 18, 18, 18, 79, 188, 7, 35, 35,
+    35, 35, 35, 35, 35, 35, 476, 35, 140, 35, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 35, 306, 477, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 478,
+    479, 480, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 481, 35, 35, 35, 35, 35, 482, 35, 483,
+    35, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 308, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 62, 7,
+    143, 7, 97, 7, 484, 485, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 18, 18,
+    18, 18, 18, 135, 18, 18, 132, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 100, 486, 487, 488, 489, 181, 35, 35, 35, 490, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 491, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 22, 7, 7, 7, 7, 7, 7, 7, 7, 22, 492,
+    493, 7, 347, 117, 7, 7, 7, 7, 7, 7, 7, 27, 193, 22, 22, 7, 7, 7, 494, 199,
+    125, 74, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 165, 7, 7, 7, 74,
+    7, 7, 159, 7, 7, 7, 159, 7, 7, 22, 7, 7, 7, 22, 7, 7, 15, 7, 7, 7, 15, 7, 7,
+    7, 74, 7, 7, 7, 74, 7, 7, 159, 495, 4, 4, 4, 4, 4, 4, 18, 18, 18, 18, 18,
+    18, 132, 151, 18, 18, 18, 18, 18, 134, 359, 35, 496, 406, 35, 151, 32, 18,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 15, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 132, 18, 18, 497, 498, 407, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7,
+    7, 7, 143, 436, 165, 4, 499, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 7, 7, 7, 500, 35, 35, 7, 7, 7, 7, 7,
+    184, 4, 501, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 15, 446, 7, 15, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 143, 35, 132,
+    35, 35, 35, 35, 35, 7, 7, 7, 7, 7, 7, 7, 7, 184, 502, 4, 503, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    504, 351, 35, 35, 35, 35, 35, 35, 35, 35, 35, 117, 7, 7, 7, 505, 6, 159,
+    506, 507, 508, 505, 198, 505, 159, 159, 91, 7, 26, 7, 202, 509, 26, 7, 202,
+    35, 35, 35, 35, 35, 35, 35, 35, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 35, 510, 35, 35, 35, 243, 7, 7, 7,
+    249, 7, 7, 7, 511, 512, 513, 7, 514, 244, 246, 35, 510, 262, 262, 262, 262,
+    262, 262, 515, 516, 516, 516, 517, 262, 306, 518, 306, 338, 519, 520, 306,
+    517, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 521, 262, 262, 522, 262, 262,
+    523, 524, 525, 526, 262, 262, 262, 262, 262, 527, 262, 262, 262, 262, 262,
+    262, 262, 262, 528, 529, 530, 262, 531, 529, 529, 532, 533, 534, 535, 262,
+    536, 537, 538, 262, 262, 262, 262, 262, 262, 262, 262, 262, 259, 262, 539,
+    254, 261, 262, 266, 260, 540, 541, 262, 262, 262, 262, 542, 543, 262, 262,
+    544, 262, 262, 262, 262, 262, 262, 262, 545, 546, 262, 262, 545, 541, 262,
+    262, 262, 262, 262, 262, 262, 262, 547, 548, 35, 35, 35, 35, 549, 550, 262,
+    262, 262, 262, 551, 262, 552, 262, 530, 553, 262, 262, 262, 262, 262, 262,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 554, 262, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 510, 262, 262, 262, 262, 262, 35, 554, 35,
+    35, 35, 35, 35, 35, 35, 262, 35, 555, 35, 35, 35, 35, 35, 262, 35, 35, 35,
+    556, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 35, 557, 262, 529,
+    558, 262, 529, 559, 560, 262, 262, 262, 262, 262, 534, 262, 262, 262, 262,
+    262, 262, 262, 561, 562, 262, 547, 563, 564, 262, 262, 262, 262, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 546, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 565, 262, 262, 262, 262, 262, 566, 262,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 4, 136, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 567, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+    306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 309, 568,
+    35, 35, 35, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 35, 35
+};
+
+static const uint16_t break_stage3[4552] = {
+    0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x140, 0x042,
+    0x003, 0x003, 0x021, 0x0C0, 0x0C0, 0x092, 0x220, 0x2AC, 0x360, 0x320, 0x300,
+    0x360, 0x2AB, 0x280, 0x200, 0x360, 0x320, 0x2CF, 0x1A0, 0x2CD, 0x340, 0x2F0,
+    0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2F0, 0x2CE, 0x2CF,
+    0x360, 0x360, 0x360, 0x220, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x280, 0x320, 0x200, 0x360, 0x371, 0x36A, 0x36A, 0x36A, 0x280, 0x140,
+    0x1E0, 0x360, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x063, 0x0C0, 0x0C0,
+    0x120, 0x280, 0x300, 0x320, 0x320, 0x320, 0x360, 0x360, 0x360, 0xB60, 0x36A,
+    0x2A0, 0x360, 0x147, 0xB60, 0x360, 0x300, 0x320, 0x360, 0x360, 0x160, 0x36A,
+    0x360, 0x36E, 0x360, 0x360, 0x36A, 0x2A0, 0x360, 0x360, 0x360, 0x280, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x16A, 0x36A, 0x36A, 0x36A,
+    0x16A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A,
+    0x16A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x124, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x124,
+    0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x2CF, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x36E, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36E, 0x36A, 0x2CF, 0x14A, 0x360, 0x360,
+    0x360, 0x360, 0x320, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x0C4, 0x360, 0x0C4, 0x0C4,
+    0x360, 0x0C4, 0x0C4, 0x220, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389,
+    0x389, 0x389, 0x360, 0x360, 0x360, 0x360, 0x389, 0x389, 0x389, 0x389, 0x36A,
+    0x36E, 0x360, 0x360, 0x360, 0x367, 0x367, 0x367, 0x367, 0x367, 0x367, 0x360,
+    0x360, 0x360, 0x300, 0x300, 0x300, 0x2CF, 0x2CF, 0x360, 0x360, 0x0C4, 0x0C4,
+    0x0C4, 0x220, 0x0C7, 0x220, 0x220, 0x220, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x2F0, 0x2F0, 0x300, 0x2F0, 0x2EF, 0x360, 0x36A, 0x36A,
+    0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x220, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x367,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x0C4, 0x0C4,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x2F0, 0x2F0, 0x36A, 0x36A,
+    0x36A, 0x360, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x367, 0x36A, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4,
+    0x0C4, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x2F0, 0x2F0, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x36A, 0x36A, 0x360, 0x360, 0x2CF, 0x220, 0x36A, 0x360, 0x360, 0x0C4,
+    0x320, 0x320, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360,
+    0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x367, 0x367, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x367, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x36A,
+    0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x140, 0x140, 0x2F0, 0x2F0, 0x36A, 0x0C4, 0x0C4, 0x0C4,
+    0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360,
+    0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x360,
+    0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x0C4, 0x36A, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x0C4, 0x0C4, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x360, 0x360, 0x2F0, 0x2F0, 0x36A, 0x36A, 0x300, 0x300,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x300, 0x360, 0x320, 0x36A, 0x360, 0x0C4,
+    0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x0C4, 0x360, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x2F0, 0x2F0, 0x0C4, 0x0C4, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x360, 0x360, 0x36A, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x320, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x0C4, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x36A,
+    0x36A, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x36A, 0x36A,
+    0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360,
+    0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x360, 0x36A,
+    0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x160, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x160, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4,
+    0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x36A, 0x36A, 0x36A, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x36A, 0x360, 0x300, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360,
+    0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x360, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x360, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x360, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x320,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x2F0, 0x2F0, 0x140,
+    0x140, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360,
+    0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x2F0,
+    0x2F0, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x160, 0x160, 0x160,
+    0x160, 0x360, 0x160, 0x160, 0x120, 0x160, 0x160, 0x140, 0x120, 0x220, 0x220,
+    0x220, 0x220, 0x220, 0x120, 0x360, 0x220, 0x360, 0x360, 0x360, 0x0C4, 0x0C4,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x140,
+    0x0C4, 0x360, 0x0C4, 0x360, 0x0C4, 0x280, 0x1E0, 0x280, 0x1E0, 0x0C4, 0x0C4,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x144, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x140,
+    0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x140, 0x140, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x0C4, 0x360, 0x160, 0x160, 0x140, 0x160, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x120, 0x120, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4,
+    0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x0C4, 0x360, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x2F0, 0x2F0, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x44A, 0x44A, 0x44A, 0x44A, 0x44A, 0x44A, 0x44A,
+    0x44A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x48A, 0x48A,
+    0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x36A, 0x36A, 0x36A, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x140, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x152, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x280, 0x1E0, 0x360, 0x360, 0x360, 0x36A,
+    0x36A, 0x36A, 0x140, 0x140, 0x140, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x140,
+    0x360, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x360,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x140, 0x260, 0x360,
+    0x140, 0x360, 0x140, 0x320, 0x360, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x220,
+    0x220, 0x140, 0x140, 0x160, 0x360, 0x220, 0x220, 0x360, 0x0C4, 0x0C4, 0x0C4,
+    0x127, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x36A, 0x36A,
+    0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x220, 0x220, 0x2F0,
+    0x2F0, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x2F0, 0x2F0, 0x140, 0x140, 0x360,
+    0x140, 0x140, 0x140, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x140, 0x140, 0x360, 0x0C4, 0x0C4, 0x0C4,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x36A, 0x36A, 0x360, 0x360, 0x360, 0x140, 0x140, 0x140, 0x140, 0x140, 0x2F0,
+    0x2F0, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x140, 0x140, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4,
+    0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x160, 0x360, 0x360, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152,
+    0x120, 0x152, 0x152, 0x152, 0x0A0, 0x0C4, 0x0E5, 0x0C7, 0x0C7, 0x140, 0x120,
+    0x140, 0x140, 0x180, 0x360, 0x360, 0x360, 0x2AD, 0x2AD, 0x280, 0x2A0, 0x2A0,
+    0x2A0, 0x280, 0x2A0, 0x360, 0x360, 0x360, 0x360, 0x24D, 0x240, 0x240, 0x14E,
+    0x003, 0x003, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x131, 0x300, 0x300, 0x300,
+    0x300, 0x300, 0x300, 0x300, 0x300, 0x360, 0x2A0, 0x2A0, 0x360, 0xA60, 0x260,
+    0x360, 0x371, 0x371, 0x360, 0x360, 0x360, 0x2CF, 0x280, 0x1E0, 0x260, 0x260,
+    0xA60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x371, 0x360, 0x140, 0x360, 0x140, 0x140, 0x140, 0x140, 0x360, 0x140, 0x140,
+    0x152, 0x107, 0x367, 0x367, 0x367, 0x367, 0x360, 0x0C7, 0x0C7, 0x0C7, 0x0C7,
+    0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x280, 0x1E0, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x280, 0x1E0, 0x360,
+    0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x300, 0x320, 0x320, 0x320,
+    0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320,
+    0x300, 0x320, 0x320, 0x320, 0x320, 0x300, 0x320, 0x320, 0x300, 0x320, 0x300,
+    0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x320, 0x0C4, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x300, 0x360, 0x360, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x320, 0x360, 0x360, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0xB60, 0x360, 0x36A,
+    0x360, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A,
+    0x36A, 0xB6A, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0xB60, 0xB60, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x320, 0x320, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x240, 0x280, 0x1E0,
+    0x280, 0x1E0, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0xBA0, 0xBA0, 0x360,
+    0x360, 0x360, 0x360, 0xB60, 0x4C0, 0x1E0, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0xB60, 0x360, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x360, 0x360, 0x360, 0x360, 0xB60,
+    0xB60, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0xB6A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0xB60, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0xB60, 0x360, 0x360, 0x360, 0x360, 0xB60, 0xB60, 0xB60, 0xB60, 0x360,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60, 0x360, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0x360, 0xBA0, 0xBA0,
+    0xB60, 0xB60, 0xBA0, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xB60,
+    0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60, 0xB60, 0xB60, 0xBA0, 0xB60, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xBA0, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0x360, 0x360, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60, 0xB60, 0xB60, 0xBA0, 0xB60, 0xBA0,
+    0xBA0, 0xBA0, 0xB60, 0xBA0, 0xBA0, 0xB60, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xB60,
+    0xB60, 0xBA0, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xB60, 0xB60, 0xBA0, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xB60,
+    0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0x360,
+    0x360, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xB60, 0xB60, 0xB60, 0xB60,
+    0xB60, 0x360, 0xB60, 0x360, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0xB60, 0x360, 0x360, 0x360, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0xB60, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0xB60, 0x360, 0x360, 0xB60, 0x360, 0x360, 0x360, 0x360, 0xB60, 0x360,
+    0xB60, 0x360, 0x360, 0x360, 0x360, 0xB60, 0xB60, 0xB60, 0x360, 0xB60, 0x360,
+    0x360, 0x360, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x360, 0x220, 0xA20,
+    0xBA0, 0xB60, 0xB60, 0xB60, 0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x280,
+    0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0xB60, 0xB60, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x280, 0x1E0, 0x360, 0x360, 0x360, 0x360, 0xB60, 0xB60, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0,
+    0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x280, 0x1E0, 0x360, 0x360, 0xB60,
+    0x360, 0x360, 0x360, 0x360, 0xB60, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x220, 0x140, 0x140, 0x140, 0x360, 0x220, 0x140, 0x2A0, 0x2A0,
+    0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0, 0x2A0,
+    0x2A0, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x360, 0x140,
+    0x280, 0x140, 0x360, 0x360, 0x2A0, 0x2A0, 0x360, 0x360, 0x2A0, 0x2A0, 0x280,
+    0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x280, 0x1E0, 0x140, 0x140, 0x140, 0x140,
+    0x220, 0x36A, 0x140, 0x140, 0x360, 0x140, 0x140, 0x360, 0x360, 0x360, 0x360,
+    0x360, 0x180, 0x180, 0x140, 0x140, 0x140, 0x360, 0x140, 0x140, 0x280, 0x140,
+    0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x360, 0x140, 0x360, 0x140,
+    0x140, 0x360, 0x360, 0x360, 0x220, 0x220, 0x280, 0x1E0, 0x280, 0x1E0, 0x280,
+    0x1E0, 0x280, 0x1E0, 0x140, 0x360, 0x360, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x360, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x360, 0x360, 0x360, 0x360, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x360, 0x360, 0x152, 0x1E0, 0x1E0, 0x3A0, 0x3A0, 0x26A,
+    0x3A0, 0x3A0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0,
+    0x1E0, 0x3A0, 0x3A0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0,
+    0x260, 0x4C0, 0x1E0, 0x1E0, 0x3A0, 0x3A0, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0xBA0, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x0C8, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x26A, 0x26A, 0xBA0, 0x3A0, 0x3A0, 0x360, 0x260, 0x3A0, 0x260, 0x3A0,
+    0x260, 0x3A0, 0x260, 0x3A0, 0x260, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x260, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x260, 0x3A0, 0x260, 0x3A0, 0x260, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0,
+    0x260, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x260, 0x260, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x268, 0x268, 0x260, 0x260, 0x3A0, 0x268, 0x268, 0x3A8, 0x268,
+    0x3A8, 0x268, 0x3A8, 0x268, 0x3A8, 0x268, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8,
+    0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8,
+    0x3A8, 0x268, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x268, 0x3A8,
+    0x268, 0x3A8, 0x268, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x268, 0x3A8,
+    0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x268, 0x268, 0x3A8, 0x3A8, 0x3A8, 0x3A8,
+    0x260, 0x268, 0x268, 0x268, 0x3A8, 0x360, 0x360, 0x360, 0x360, 0x360, 0x3AA,
+    0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x360,
+    0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA,
+    0x3AA, 0x3AA, 0x3AA, 0x360, 0x268, 0x268, 0x268, 0x268, 0x268, 0x268, 0x268,
+    0x268, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x360, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0xBA0, 0x3A0, 0xBA0, 0x3A0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3A0, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A0,
+    0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x26A, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA,
+    0x3AA, 0x3AA, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x140,
+    0x220, 0x140, 0x2F0, 0x2F0, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x36A, 0x0C4, 0x0C4, 0x360, 0x140,
+    0x140, 0x140, 0x140, 0x140, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x0C4, 0x36A, 0x36A, 0x36A, 0x0C4, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x0C4,
+    0x360, 0x360, 0x360, 0x300, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x160, 0x160, 0x220, 0x220, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x140, 0x140, 0x360, 0x360, 0x360, 0x36A, 0x160, 0x36A,
+    0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x140, 0x44A,
+    0x44A, 0x44A, 0x44A, 0x44A, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x140, 0x140, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x360, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x0C4, 0x0C4, 0x360, 0x360, 0x2F0, 0x2F0, 0x360, 0x360, 0x360,
+    0x140, 0x140, 0x140, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360,
+    0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x140, 0x140, 0x36A,
+    0x36A, 0x36A, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x0C4, 0x0C4,
+    0x360, 0x360, 0x40A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A,
+    0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A,
+    0x40A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x42A, 0x360, 0x360, 0x360,
+    0x360, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x46A, 0x360, 0x360, 0x360,
+    0x360, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x48A, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x389, 0x0C4, 0x389, 0x389, 0x360, 0x389,
+    0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389, 0x389,
+    0x389, 0x360, 0x389, 0x389, 0x389, 0x389, 0x389, 0x360, 0x389, 0x360, 0x389,
+    0x389, 0x360, 0x389, 0x389, 0x360, 0x389, 0x389, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x1E0, 0x280, 0x36A, 0x36A, 0x36A, 0x36A, 0x300, 0x360, 0x360,
+    0x360, 0x2CF, 0x1E0, 0x1E0, 0x2CE, 0x2CF, 0x220, 0x220, 0x4C0, 0x1E0, 0x240,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x3A0, 0x3A0, 0x3A0, 0x3B1, 0x3B1,
+    0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0,
+    0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x3A0, 0x3A0, 0x4C0, 0x1E0, 0x3A0, 0x3A0,
+    0x3A0, 0x3A0, 0x3B1, 0x3B1, 0x3B1, 0x1EF, 0x3A0, 0x1ED, 0x360, 0x26F, 0x26E,
+    0x220, 0x220, 0x3A0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x4C0, 0x1E0, 0x3A0, 0x3A0,
+    0x320, 0x300, 0x3A0, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x360, 0x360, 0x107, 0x360, 0x220, 0x3A0, 0x3A0, 0x320, 0x300, 0x3A0,
+    0x3AD, 0x4C0, 0x1E0, 0x3A0, 0x3A0, 0x1EF, 0x3A0, 0x1ED, 0x3A0, 0x3B0, 0x3B0,
+    0x3B0, 0x3B0, 0x3B0, 0x3B0, 0x3B0, 0x3B0, 0x3B0, 0x3B0, 0x26E, 0x26F, 0x3A0,
+    0x3A0, 0x3A0, 0x220, 0x3A0, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x3AA,
+    0x3AA, 0x3AA, 0x3AA, 0x4C0, 0x3A0, 0x1E0, 0x3A0, 0x3B1, 0x3AA, 0x3AA, 0x3AA,
+    0x4C0, 0x3A0, 0x1E0, 0x3A0, 0x4C0, 0x1E0, 0x1E0, 0x4C0, 0x1E0, 0x1E0, 0x260,
+    0x3A8, 0x268, 0x268, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8,
+    0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x3A8, 0x264, 0x264, 0x360, 0x360, 0x3AA, 0x3AA,
+    0x3AA, 0x3AA, 0x3AA, 0x3AA, 0x360, 0x360, 0x3AA, 0x3AA, 0x3AA, 0x360, 0x360,
+    0x360, 0x300, 0x320, 0x3A0, 0x3A0, 0x3A0, 0x320, 0x320, 0x360, 0x360, 0x0C7,
+    0x0C7, 0x0C7, 0x1C0, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x36A,
+    0x36A, 0x360, 0x36A, 0x140, 0x140, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x360, 0x140, 0x140, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x360, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x360, 0x36A,
+    0x360, 0x360, 0x360, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x140, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x360, 0x140, 0x140,
+    0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x0C4, 0x0C4, 0x360, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x240, 0x360,
+    0x360, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x36A, 0x36A, 0x360,
+    0x0C4, 0x0C4, 0x140, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x140, 0x0C4, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x360, 0x360, 0x367, 0x140, 0x140, 0x140, 0x140, 0x0C4, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x367, 0x360,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x2F0, 0x2F0, 0x140, 0x140,
+    0x140, 0x140, 0x36A, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x360,
+    0x160, 0x36A, 0x360, 0x0C4, 0x36A, 0x36A, 0x36A, 0x36A, 0x140, 0x140, 0x360,
+    0x140, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x2F0, 0x2F0, 0x36A,
+    0x160, 0x36A, 0x140, 0x140, 0x140, 0x140, 0x140, 0x360, 0x140, 0x140, 0x360,
+    0x0C4, 0x360, 0x36A, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x0C4,
+    0x0C4, 0x36A, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x140, 0x140, 0x140, 0x140, 0x360, 0x2F0, 0x2F0, 0x140, 0x140, 0x360,
+    0x360, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x360, 0x36A,
+    0x0C4, 0x160, 0x140, 0x140, 0x220, 0x220, 0x360, 0x360, 0x0C4, 0x140, 0x140,
+    0x360, 0x36A, 0x360, 0x360, 0x360, 0x160, 0x160, 0x160, 0x160, 0x160, 0x160,
+    0x160, 0x160, 0x160, 0x160, 0x160, 0x160, 0x160, 0x360, 0x360, 0x360, 0x2F0,
+    0x2F0, 0x360, 0x360, 0x140, 0x140, 0x140, 0x360, 0x360, 0x36A, 0x360, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A,
+    0x360, 0x0C4, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x36A,
+    0x0C4, 0x0C4, 0x140, 0x140, 0x140, 0x360, 0x0C4, 0x36A, 0x160, 0x36A, 0x0C4,
+    0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x160,
+    0x360, 0x140, 0x140, 0x140, 0x140, 0x160, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x140,
+    0x140, 0x140, 0x36A, 0x160, 0x160, 0x160, 0x140, 0x140, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x36A, 0x140, 0x140, 0x140, 0x140, 0x140, 0x360, 0x360, 0x160,
+    0x220, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x360,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x0C4, 0x36A, 0x36A,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x36A, 0x36A, 0x36A, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x300, 0x300, 0x300, 0x140, 0x140, 0x140,
+    0x140, 0x140, 0x360, 0x360, 0x360, 0x28A, 0x28A, 0x28A, 0x1EA, 0x1EA, 0x1EA,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x1EA, 0x36A, 0x36A, 0x36A, 0x28A, 0x1EA, 0x28A,
+    0x1EA, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x28A, 0x1EA, 0x1EA,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127,
+    0x287, 0x1E7, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x28A, 0x1EA, 0x2F0, 0x2F0, 0x360, 0x360, 0x360,
+    0x360, 0x140, 0x140, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x140, 0x360, 0x360,
+    0x140, 0x140, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x140, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x360,
+    0x360, 0x0C4, 0x26A, 0x26A, 0x260, 0x26A, 0x124, 0x360, 0x360, 0x360, 0x3A0,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x368, 0x368, 0x368, 0x368,
+    0x360, 0x368, 0x368, 0x368, 0x368, 0x368, 0x368, 0x368, 0x360, 0x368, 0x368,
+    0x360, 0x3A8, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A8, 0x3A8,
+    0x3A8, 0x360, 0x360, 0x360, 0x360, 0x360, 0x260, 0x260, 0x260, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x268, 0x268, 0x268, 0x268,
+    0x36A, 0x36A, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x140, 0x0C7, 0x0C7, 0x0C7,
+    0x0C7, 0x360, 0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x0C7, 0x0C7,
+    0x0C7, 0x0C7, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360,
+    0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360,
+    0x360, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A, 0x360,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x360, 0x360, 0x2F0, 0x2F0, 0x360, 0x360, 0x360,
+    0x360, 0x0C4, 0x360, 0x360, 0x140, 0x0C4, 0x360, 0x360, 0x0C4, 0x0C4, 0x0C4,
+    0x0C4, 0x0C4, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x360, 0x0C4, 0x0C4, 0x2F0,
+    0x2F0, 0x360, 0x360, 0x360, 0x360, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x0C4, 0x360, 0x2F0, 0x2F0, 0x360, 0x360, 0x360, 0x360, 0x360,
+    0x320, 0x0C4, 0x0C4, 0x0C4, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x2F0, 0x2F0,
+    0x360, 0x360, 0x360, 0x360, 0x280, 0x280, 0x360, 0x360, 0x360, 0x360, 0x300,
+    0x360, 0x360, 0x360, 0x360, 0x36A, 0x36A, 0x360, 0x36A, 0x360, 0x360, 0x36A,
+    0x360, 0x36A, 0x360, 0x36A, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x36A,
+    0x360, 0x360, 0x360, 0x360, 0x36A, 0x360, 0x36A, 0x360, 0x36A, 0x360, 0x36A,
+    0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x360, 0x36A, 0x36A, 0x36A, 0x360,
+    0x360, 0x360, 0x360, 0x360, 0xBA0, 0xBA0, 0xBA0, 0x36A, 0x36A, 0x360, 0x360,
+    0xB60, 0xBA0, 0xBA0, 0xBA0, 0xB6A, 0xB6A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
+    0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0xB6A, 0xB6A, 0x36A, 0x36A,
+    0x360, 0x360, 0x360, 0x360, 0xB60, 0x360, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6, 0x4A6,
+    0x3A0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x3A0, 0x3A0, 0xBA0,
+    0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0x3A0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x3A0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x3E4, 0x3E4, 0x3E4, 0x3E4, 0x3E4,
+    0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0,
+    0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0,
+    0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0,
+    0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBC0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xBA0,
+    0xB60, 0xBA0, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xB60, 0xBA0, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0x360, 0x360, 0x360,
+    0x360, 0x360, 0x360, 0xB60, 0xB60, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xB60, 0xB60, 0xB60,
+    0xB60, 0xB60, 0xB60, 0xB60, 0xB60, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0,
+    0xBC0, 0xBC0, 0xBC0, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0x2A0, 0x2A0,
+    0x2A0, 0x260, 0x260, 0x260, 0x360, 0x360, 0x360, 0x360, 0xBA0, 0xBA0, 0xBA0,
+    0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0,
+    0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0x360,
+    0x360, 0x360, 0x360, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x360, 0x360, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360, 0xBA0,
+    0xBA0, 0x360, 0x360, 0x360, 0x360, 0xBC0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBA0, 0xBC0, 0xBC0, 0xBA0, 0x3A0, 0xBC0,
+    0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x3A0, 0xBA0,
+    0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBA0, 0xBC0, 0xBC0, 0xBA0,
+    0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0,
+    0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0,
+    0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBC0, 0xBC0, 0xBC0, 0xBC0,
+    0xBC0, 0xBC0, 0xBC0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0xBA0, 0x360,
+    0x360, 0x360, 0x0C7, 0x360, 0x360, 0x360, 0x360, 0x360, 0x360
+};
+
+#define WORD_CLASS(p) ((p)&0x1F)
+#define LINE_CLASS(p) (((p) >> 5) & 0x3F)
+#define EXT_PICT(p) (((p) >> 11) & 1)
+
+static utf8_inline uint16_t break_props(utf8_code_pt c) {
+  const size_t i2 = ((size_t)break_stage1[c >> 8] << 5) | ((c >> 3) & 0x1F);
+  return break_stage3[((size_t)break_stage2[i2] << 3) | (c & 7)];
+}
+
+// Pair table for line breaks, see UAX #14, section 7.
+// Rows are the class before the break, columns the class after it.
+// D: Direct break.
+// I: Indirect break, only if spaces are in between.
+// P: Prohibited, even if spaces are in between.
+// C: Combining mark. Break only if spaces are in between, otherwise the mark
+//    attaches to the symbol before it.
+// X: Combining mark, never break.
+// Generated from rules LB8 to LB30b.
+enum pair_action { D, I, P, C, X };
+static const uint8_t line_pairs[LB_COUNT][LB_COUNT] = {
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // BK
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // CR
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // LF
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // NL
+    {D, D, D, D, D, D, C, C, P, D, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // SP
+    {D, D, D, D, D, D, C, C, D, D, D, D, D, D, D, D, D, D, D, D,
+     D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D}, // ZW
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // CM
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // ZWJ
+    {I, I, I, I, I, I, C, C, P, I, I, I, I, I, I, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, I, I, I, I, I, I, I, I, I, I, P}, // WJ
+    {I, I, I, I, I, I, C, C, P, I, I, I, I, I, I, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, I, I, I, I, I, I, I, I, I, I, P}, // GL
+    {D, D, D, D, D, D, C, C, P, D, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // BA
+    {I, I, I, I, I, I, C, C, P, I, I, I, I, I, D, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, I, I, I, I, I, I, I, I, I, I, P}, // BB
+    {D, D, D, D, D, D, C, C, P, I, I, D, P, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // B2
+    {D, D, D, D, D, D, C, C, P, D, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, I, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // HY
+    {D, D, D, D, D, D, C, C, P, I, D, D, D, D, D, P, P, P, D, D,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // CB
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, P,
+     D, I, P, D, I, I, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // CL
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, P,
+     D, I, P, I, I, I, P, I, I, D, D, D, D, D, D, D, D, D, D, P}, // CP
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // EX
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // IN
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // NS
+    {P, P, P, P, P, P, X, X, P, P, P, P, P, P, P, P, P, P, P, P,
+     P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P}, // OP
+    {I, I, I, I, I, I, C, C, P, I, I, I, I, I, I, P, P, P, I, I,
+     P, I, P, I, I, I, P, I, I, I, I, I, I, I, I, I, I, I, P, P}, // QU
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, I, D, D, P, I, I, D, D, D, D, D, D, D, D, D, D, P}, // IS
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, D, D, D, D, D, D, D, D, D, D, P}, // NU
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     I, I, P, I, D, D, P, I, I, D, D, D, D, D, D, D, D, D, I, P}, // PO
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     I, I, P, I, D, D, P, I, I, I, I, I, I, I, I, I, I, D, I, P}, // PR
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, I, D, D, P, D, I, D, D, D, D, D, D, D, D, D, D, P}, // SY
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, D, D, D, D, D, D, D, D, D, D, P}, // AL
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     I, I, P, I, I, I, P, I, I, D, D, D, D, D, D, D, D, D, D, P}, // HL
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // ID
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, I, D, D, D, D, D, D, D, P}, // EB
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // EM
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, I, I, D, D, P}, // H2
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, D, I, D, D, P}, // H3
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, I, I, I, I, D, D, D, P}, // JL
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, I, I, D, D, P}, // JV
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, I, D, P, D, D, D, D, D, D, D, D, D, I, D, D, P}, // JT
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, I,
+     D, I, P, D, D, D, P, D, D, D, D, D, D, D, D, D, D, I, D, P}, // RI
+    {P, P, P, P, P, P, X, X, P, P, P, P, P, P, P, P, P, P, P, P,
+     P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P}, // OPW
+    {D, D, D, D, D, D, C, C, P, I, I, D, D, I, D, P, P, P, I, P,
+     D, I, P, D, I, I, P, D, D, D, D, D, D, D, D, D, D, D, D, P}, // CPW
+};
+
+static void push_break(struct utf8_break_iter *const it, size_t offset,
+                       enum utf8_break_type type) {
+  it->queue_offset[it->queue_len] = offset;
+  it->queue_type[it->queue_len] = (uint8_t)type;
+  it->queue_len++;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Word boundaries                                         //
+//////////////////////////////////////////////////////////////////////
+
+static utf8_inline bool is_ahletter(const uint8_t c) {
+  return c == WB_ALETTER || c == WB_HEBREW_LETTER;
+}
+
+static utf8_inline bool is_midletter_q(const uint8_t c) {
+  return c == WB_MIDLETTER || c == WB_MIDNUMLET || c == WB_SINGLE_QUOTE;
+}
+
+static utf8_inline bool is_midnum_q(const uint8_t c) {
+  return c == WB_MIDNUM || c == WB_MIDNUMLET || c == WB_SINGLE_QUOTE;
+}
+
+static utf8_inline bool is_newline(const uint8_t c) {
+  return c == WB_CR || c == WB_LF || c == WB_NEWLINE;
+}
+
+static utf8_inline bool is_ignored(const uint8_t c) {
+  return c == WB_EXTEND || c == WB_FORMAT || c == WB_ZWJ;
+}
+
+// Decide whether there is a word boundary before a symbol. Returns true for
+// a boundary. Rules which depend on the symbol after this one set up a
+// pending boundary instead.
+static bool word_rules(struct utf8_break_iter *const it, const uint8_t y,
+                       const bool ext_pict, const size_t offset) {
+  const uint8_t r = it->prev_raw;
+  const uint8_t a = it->cls;
+  const uint8_t a0 = it->cls_before;
+
+  if (r == WB_CR && y == WB_LF) // WB3
+    return false;
+  if (is_newline(r) || is_newline(y)) // WB3a, WB3b
+    return true;
+  if (r == WB_ZWJ && ext_pict) // WB3c
+    return false;
+  if (r == WB_WSEGSPACE && y == WB_WSEGSPACE) // WB3d
+    return false;
+  if (is_ignored(y)) // WB4
+    return false;
+
+  if (is_ahletter(a) && is_ahletter(y)) // WB5
+    return false;
+  if (a == WB_HEBREW_LETTER && y == WB_SINGLE_QUOTE) // WB7a
+    return false;
+  if (is_ahletter(a) && is_midletter_q(y)) { // WB6
+    it->pending = true;
+    it->pending_need = WB_ALETTER;
+    it->pending_offset = offset;
+    return false;
+  }
+  if (is_ahletter(a0) && is_midletter_q(a) && is_ahletter(y)) // WB7
+    return false;
+  if (a == WB_HEBREW_LETTER && y == WB_DOUBLE_QUOTE) { // WB7b
+    it->pending = true;
+    it->pending_need = WB_HEBREW_LETTER;
+    it->pending_offset = offset;
+    return false;
+  }
+  if (a0 == WB_HEBREW_LETTER && a == WB_DOUBLE_QUOTE &&
+      y == WB_HEBREW_LETTER) // WB7c
+    return false;
+  if ((a == WB_NUMERIC || is_ahletter(a)) &&
+      (y == WB_NUMERIC || is_ahletter(y))) // WB8, WB9, WB10
+    return false;
+  if (a0 == WB_NUMERIC && is_midnum_q(a) && y == WB_NUMERIC) // WB11
+    return false;
+  if (a == WB_NUMERIC && is_midnum_q(y)) { // WB12
+    it->pending = true;
+    it->pending_need = WB_NUMERIC;
+    it->pending_offset = offset;
+    return false;
+  }
+  if (a == WB_KATAKANA && y == WB_KATAKANA) // WB13
+    return false;
+  if ((is_ahletter(a) || a == WB_NUMERIC || a == WB_KATAKANA ||
+       a == WB_EXTENDNUMLET) &&
+      y == WB_EXTENDNUMLET) // WB13a
+    return false;
+  if (a == WB_EXTENDNUMLET &&
+      (is_ahletter(y) || y == WB_NUMERIC || y == WB_KATAKANA)) // WB13b
+    return false;
+  if (a == WB_REGIONAL_INDICATOR && y == WB_REGIONAL_INDICATOR &&
+      (it->ri_count & 1) != 0) // WB15, WB16
+    return false;
+  return true; // WB999
+}
+
+static void word_step(struct utf8_break_iter *const it, const uint16_t props,
+                      const size_t offset) {
+  const uint8_t y = WORD_CLASS(props);
+
+  if (it->at_start) {
+    // WB1: No boundary at the start of the text.
+    it->at_start = false;
+  } else {
+    // A boundary which depends on this symbol. Ignored symbols are skipped
+    // (WB4), but newlines are not.
+    if (it->pending && !is_ignored(y)) {
+      it->pending = false;
+      const bool match = it->pending_need == WB_ALETTER
+                             ? is_ahletter(y)
+                             : y == it->pending_need;
+      if (!match)
+        push_break(it, it->pending_offset, UTF8_BREAK_ALLOWED);
+    }
+
+    const bool attach = is_ignored(y) && !is_newline(it->prev_raw);
+    if (word_rules(it, y, EXT_PICT(props), offset))
+      push_break(it, offset, UTF8_BREAK_ALLOWED);
+
+    if (attach) {
+      it->prev_raw = y;
+      return;
+    }
+  }
+
+  it->ri_count = y == WB_REGIONAL_INDICATOR ? it->ri_count + 1 : 0;
+  it->cls_before = it->cls;
+  it->cls = y;
+  it->prev_raw = y;
+}
+
+static utf8_inline uint8_t word_class_ascii(const uint8_t b) {
+  if (b >= '0' && b <= '9')
+    return WB_NUMERIC;
+  if (b == '_')
+    return WB_EXTENDNUMLET;
+  return WB_ALETTER;
+}
+
+static utf8_inline bool is_ascii_alnum(const uint8_t b) {
+  const uint8_t l = b | 0x20;
+  return (l >= 'a' && l <= 'z') || (b >= '0' && b <= '9');
+}
+
+#if defined(__SSE2__)
+// Bytes in the range lo..hi.
+static utf8_inline __m128i in_range_epi8(const __m128i v, const char lo,
+                                         const char hi) {
+  const __m128i t = _mm_add_epi8(v, _mm_set1_epi8((char)(-128 - lo)));
+  return _mm_cmplt_epi8(t, _mm_set1_epi8((char)(-128 + (hi - lo) + 1)));
+}
+#endif
+
+// Length of the run of ASCII letters and digits (and '_' for words) at the
+// start of s.
+static size_t ascii_alnum_run(const uint8_t *const s, const size_t len,
+                              const bool underscore) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i case_bit = _mm_set1_epi8(0x20);
+  const __m128i under = _mm_set1_epi8(underscore ? '_' : 0);
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    const __m128i m = _mm_or_si128(
+        _mm_or_si128(in_range_epi8(_mm_or_si128(v, case_bit), 'a', 'z'),
+                     in_range_epi8(v, '0', '9')),
+        _mm_cmpeq_epi8(v, under));
+    const unsigned mask = (unsigned)_mm_movemask_epi8(m);
+    if (mask != 0xFFFF)
+      return i + (size_t)__builtin_ctz(~mask);
+  }
+#endif
+  while (i < len && (is_ascii_alnum(s[i]) || (underscore && s[i] == '_')))
+    i++;
+  return i;
+}
+
+// Runs of ASCII letters, digits and '_' after a letter, digit or '_' never
+// contain a boundary (WB5, WB8, WB9, WB10, WB13a, WB13b).
+static void word_fast_path(struct utf8_break_iter *const it) {
+  const uint8_t a = it->cls;
+  if (it->at_start || it->pending || it->prev_raw != a ||
+      (a != WB_ALETTER && a != WB_NUMERIC && a != WB_EXTENDNUMLET))
+    return;
+
+  const uint8_t *const s = it->chunk + it->pos;
+  const size_t n = ascii_alnum_run(s, it->chunk_len - it->pos, true);
+  if (n == 0)
+    return;
+
+  it->cls_before = n > 1 ? word_class_ascii(s[n - 2]) : a;
+  it->cls = it->prev_raw = word_class_ascii(s[n - 1]);
+  it->ri_count = 0;
+  it->pos += n;
+  it->offset += n;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Line breaks                                             //
+//////////////////////////////////////////////////////////////////////
+
+static utf8_inline bool is_mandatory(const uint8_t c) {
+  return c == LB_BK || c == LB_CR || c == LB_LF || c == LB_NL;
+}
+
+// Start of the text or of a new line.
+static void line_start(struct utf8_break_iter *const it, const uint8_t y) {
+  it->at_start = false;
+  it->prev_raw = y;
+  it->after_space = y == LB_SP;
+  it->after_hl_hyphen = false;
+  it->ri_count = y == LB_RI;
+  // Leading spaces behave like spaces after WJ: No break before them (LB7),
+  // but a break after them (LB18).
+  if (y == LB_SP)
+    it->cls = LB_WJ;
+  else if (y == LB_CM || y == LB_ZWJ) // LB10
+    it->cls = LB_AL;
+  else
+    it->cls = y;
+}
+
+static void line_step(struct utf8_break_iter *const it, const uint16_t props,
+                      const size_t offset) {
+  const uint8_t y = LINE_CLASS(props);
+  const uint8_t r = it->prev_raw;
+
+  if (it->at_start) {
+    line_start(it, y);
+    return;
+  }
+
+  // LB4, LB5
+  if (r == LB_BK || r == LB_LF || r == LB_NL || (r == LB_CR && y != LB_LF)) {
+    push_break(it, offset, UTF8_BREAK_MANDATORY);
+    line_start(it, y);
+    return;
+  }
+  // LB5, LB6, LB7: No break before newlines, spaces and ZW.
+  if (is_mandatory(y) || y == LB_SP) {
+    it->prev_raw = y;
+    if (y == LB_SP) {
+      it->after_space = true;
+      it->after_hl_hyphen = false;
+    }
+    return;
+  }
+
+  const uint8_t a = it->cls;
+  bool brk;
+  bool attach = false;
+
+  if (y == LB_ZW) {
+    brk = false;
+  } else if (a == LB_ZW) { // LB8
+    brk = true;
+  } else if (r == LB_ZWJ) { // LB8a
+    brk = false;
+    attach = y == LB_CM || y == LB_ZWJ;
+  } else {
+    switch (line_pairs[a][y]) {
+    case D:
+      brk = true;
+      break;
+    case I:
+      brk = it->after_space;
+      break;
+    case C:
+      brk = it->after_space;
+      attach = !it->after_space; // LB9
+      break;
+    case X:
+      brk = false;
+      attach = !it->after_space; // LB9
+      break;
+    default:
+      brk = false;
+      break;
+    }
+    if (!it->after_space) {
+      if (it->after_hl_hyphen) // LB21a
+        brk = false;
+      else if (a == LB_RI && y == LB_RI) // LB30a
+        brk = (it->ri_count & 1) == 0;
+    }
+  }
+
+  if (brk)
+    push_break(it, offset, UTF8_BREAK_ALLOWED);
+
+  it->prev_raw = y;
+  if (attach)
+    return;
+
+  it->after_hl_hyphen =
+      !it->after_space && a == LB_HL && (y == LB_HY || y == LB_BA);
+  it->ri_count =
+      y == LB_RI ? (a == LB_RI && !it->after_space ? it->ri_count + 1 : 1) : 0;
+  // LB10: A combining mark which does not attach to anything is AL.
+  it->cls = (y == LB_CM || y == LB_ZWJ) ? LB_AL : y;
+  it->after_space = false;
+}
+
+// Runs of ASCII letters and digits after a letter or digit never contain a
+// break opportunity (LB23, LB28).
+static void line_fast_path(struct utf8_break_iter *const it) {
+  const uint8_t a = it->cls;
+  if (it->at_start || it->after_space || it->after_hl_hyphen ||
+      it->prev_raw != a || (a != LB_AL && a != LB_HL && a != LB_NU))
+    return;
+
+  const uint8_t *const s = it->chunk + it->pos;
+  const size_t n = ascii_alnum_run(s, it->chunk_len - it->pos, false);
+  if (n == 0)
+    return;
+
+  const uint8_t last = s[n - 1];
+  it->cls = it->prev_raw = (last >= '0' && last <= '9') ? LB_NU : LB_AL;
+  it->ri_count = 0;
+  it->pos += n;
+  it->offset += n;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Iterator                                                //
+//////////////////////////////////////////////////////////////////////
+
+#define IS_CONTINUATION(b) (((b)&0xC0) == 0x80)
+
+static void break_init(struct utf8_break_iter *const it, const bool line) {
+  memset(it, 0, sizeof(*it));
+  it->line = line;
+  it->at_start = true;
+}
+
+void utf8_word_break_init(struct utf8_break_iter *const it) {
+  break_init(it, false);
+}
+
+void utf8_line_break_init(struct utf8_break_iter *const it) {
+  break_init(it, true);
+}
+
+void utf8_break_feed(struct utf8_break_iter *const it,
+                     const utf8_chr *const chunk, size_t len) {
+  it->chunk = (const uint8_t *)chunk;
+  it->chunk_len = len;
+  it->pos = 0;
+}
+
+void utf8_break_finish(struct utf8_break_iter *const it) {
+  it->finished = true;
+}
+
+/**
+ * Get the next symbol, completing a symbol from the previous chunk first.
+ * Invalid sequences are returned as U+FFFD with the length of the longest
+ * valid prefix (at least 1 byte).
+ * @return false if more input is needed.
+ */
+static bool next_symbol(struct utf8_break_iter *const it,
+                        utf8_code_pt *const c, size_t *const n) {
+  if (it->partial_len > 0) {
+    const int need = utf8_sequence_length_table[it->partial[0]];
+    while (it->partial_len < need && it->pos < it->chunk_len &&
+           IS_CONTINUATION(it->chunk[it->pos])) {
+      it->partial[it->partial_len++] = it->chunk[it->pos++];
+    }
+    if (it->partial_len < need && it->pos == it->chunk_len && !it->finished)
+      return false;
+
+    *n = it->partial_len;
+    it->partial_len = 0;
+    if (utf8_decode_next((const utf8_chr *)it->partial, *n, c) < 1) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      *c = 0xFFFD;
+    }
+    return true;
+  }
+
+  if (it->pos == it->chunk_len)
+    return false;
+
+  const uint8_t *const s = it->chunk + it->pos;
+  const size_t left = it->chunk_len - it->pos;
+  const int len = utf8_decode_next((const utf8_chr *)s, left, c);
+  if (len > 0) {
+    it->pos += len;
+    *n = len;
+    return true;
+  }
+
+  // Longest prefix of a valid symbol.
+  const int need = utf8_sequence_length_table[s[0]];
+  size_t k = 1;
+  while (need <= 4 && k < (size_t)need && k < left && IS_CONTINUATION(s[k]))
+    k++;
+
+  if (need <= 4 && k == left && !it->finished) {
+    // Cut off by the end of the chunk.
+    memcpy(it->partial, s, k);
+    it->partial_len = (uint8_t)k;
+    it->pos += k;
+    return false;
+  }
+
+  set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+  *c = 0xFFFD;
+  *n = k;
+  it->pos += k;
+  return true;
+}
+
+enum utf8_break_type utf8_break_next(struct utf8_break_iter *const it,
+                                     size_t *const offset) {
+  for (;;) {
+    if (it->queue_len > 0) {
+      const enum utf8_break_type type = it->queue_type[0];
+      *offset = it->queue_offset[0];
+      it->queue_offset[0] = it->queue_offset[1];
+      it->queue_type[0] = it->queue_type[1];
+      it->queue_len--;
+      return type;
+    }
+    if (it->done)
+      return UTF8_BREAK_NONE;
+
+    if (it->partial_len == 0 && it->pos < it->chunk_len) {
+      if (it->line)
+        line_fast_path(it);
+      else
+        word_fast_path(it);
+    }
+
+    utf8_code_pt c;
+    size_t n;
+    if (!next_symbol(it, &c, &n)) {
+      if (!it->finished)
+        return UTF8_BREAK_NONE;
+      // End of the text (WB2, LB3).
+      it->done = true;
+      if (it->pending)
+        push_break(it, it->pending_offset, UTF8_BREAK_ALLOWED);
+      if (it->offset > 0)
+        push_break(it, it->offset,
+                   it->line ? UTF8_BREAK_MANDATORY : UTF8_BREAK_ALLOWED);
+      continue;
+    }
+
+    const size_t start = it->offset;
+    it->offset += n;
+    if (it->line)
+      line_step(it, break_props(c), start);
+    else
+      word_step(it, break_props(c), start);
+  }
+}
@@ -0,0 +1,94 @@
+#ifndef KL_UTF8_BREAK_H
+#define KL_UTF8_BREAK_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Word boundaries (UAX #29) and line break opportunities (UAX #14) in UTF-8
+// text. The text can be passed in chunks of any size; symbols cut off by the
+// end of a chunk are completed with the next one. All state lives in the
+// iterator, so nothing is ever converted to UTF-32 and the iterator can be
+// paused and resumed between chunks.
+//
+//   struct utf8_break_iter it;
+//   size_t offset;
+//   utf8_word_break_init(&it);
+//   utf8_break_feed(&it, text, len);
+//   utf8_break_finish(&it); // text is complete
+//   while (utf8_break_next(&it, &offset) != UTF8_BREAK_NONE)
+//     printf("Boundary before byte %zu\n", offset);
+//
+// Invalid bytes are treated like U+FFFD and set utf8_lib_error.
+
+enum utf8_break_type {
+  // No more boundaries until more text is fed or the text is finished.
+  UTF8_BREAK_NONE = 0,
+  // Word boundary or line break opportunity.
+  UTF8_BREAK_ALLOWED = 1,
+  // Line break after a newline or at the end of the text.
+  UTF8_BREAK_MANDATORY = 2,
+};
+
+struct utf8_break_iter {
+  // Current chunk. pos is the next unprocessed byte.
+  const uint8_t *chunk;
+  size_t chunk_len;
+  size_t pos;
+  // Offset of the next symbol in the whole text.
+  size_t offset;
+  // A symbol which was cut off by the end of the previous chunk.
+  uint8_t partial[4];
+  uint8_t partial_len;
+
+  bool line;
+  bool at_start;
+  bool finished;
+  bool done;
+
+  // Rule state. Classes are the internal Word_Break or Line_Break values.
+  uint8_t prev_raw;   // Class of the previous symbol.
+  uint8_t cls;        // Class of the previous symbol, ignoring attachments.
+  uint8_t cls_before; // Word breaks: the class before cls.
+  bool after_space;   // Line breaks: spaces between cls and the next symbol.
+  bool after_hl_hyphen;
+  uint32_t ri_count; // Number of consecutive regional indicators.
+
+  // Word breaks: a boundary before offset pending_offset, which depends on
+  // the class of the next symbol.
+  bool pending;
+  uint8_t pending_need;
+  size_t pending_offset;
+
+  // Boundaries which were found, but not yet returned by utf8_break_next.
+  uint8_t queue_len;
+  uint8_t queue_type[2];
+  size_t queue_offset[2];
+};
+
+void utf8_word_break_init(struct utf8_break_iter *const it);
+
+void utf8_line_break_init(struct utf8_break_iter *const it);
+
+// Pass the next chunk of text. The previous chunk must have been used up,
+// that is utf8_break_next returned UTF8_BREAK_NONE.
+// The chunk has to stay valid until then.
+void utf8_break_feed(struct utf8_break_iter *const it,
+                     const utf8_chr *const chunk, size_t len);
+
+// Mark the end of the text. The remaining boundaries, including the one at
+// the end of the text, are returned by utf8_break_next.
+void utf8_break_finish(struct utf8_break_iter *const it);
+
+// Find the next boundary. Its byte offset from the start of the text is
+// stored in *offset. The start of the text is never reported.
+enum utf8_break_type utf8_break_next(struct utf8_break_iter *const it,
+                                     size_t *const offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_BREAK_H
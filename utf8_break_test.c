@@ -0,0 +1,129 @@
+#include "utest/utest.h"
+#include "utf8_break.h"
+
+// Collect all boundaries of s, fed in chunks of chunk bytes.
+static size_t collect(const bool line, const char *const s, size_t chunk,
+                      size_t *const out, bool *const mandatory) {
+  struct utf8_break_iter it;
+  const size_t len = strlen(s);
+  size_t count = 0;
+  size_t fed = 0;
+  size_t offset;
+  enum utf8_break_type type;
+
+  if (line)
+    utf8_line_break_init(&it);
+  else
+    utf8_word_break_init(&it);
+
+  do {
+    const size_t n = (chunk > 0 && len - fed > chunk) ? chunk : len - fed;
+    utf8_break_feed(&it, utf8_reinterpret_string(s + fed), n);
+    fed += n;
+    if (fed == len)
+      utf8_break_finish(&it);
+    while ((type = utf8_break_next(&it, &offset)) != UTF8_BREAK_NONE) {
+      if (mandatory)
+        mandatory[count] = type == UTF8_BREAK_MANDATORY;
+      out[count++] = offset;
+    }
+  } while (fed < len);
+  return count;
+}
+
+#define ASSERT_BREAKS(line, s, ...)                                            \
+  do {                                                                         \
+    const size_t expected[] = {__VA_ARGS__};                                   \
+    const size_t n_expected = sizeof(expected) / sizeof(expected[0]);          \
+    size_t got[64];                                                            \
+    const size_t chunks[] = {0, 1, 2, 3, 7};                                   \
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {          \
+      ASSERT_EQ(collect(line, s, chunks[c], got, NULL), n_expected);           \
+      for (size_t i = 0; i < n_expected; i++)                                  \
+        ASSERT_EQ(got[i], expected[i]);                                        \
+    }                                                                          \
+  } while (0)
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: word boundaries                                         //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_word_break, ascii) {
+  ASSERT_BREAKS(false, "Hello, world!", 5, 6, 7, 12, 13);
+  // WB6, WB7, WB11, WB12
+  ASSERT_BREAKS(false, "can't 3.14 e.g.", 5, 6, 10, 11, 14, 15);
+  // WB13a, WB13b
+  ASSERT_BREAKS(false, "snake_case x", 10, 11, 12);
+  // Pending boundary at the end of the text.
+  ASSERT_BREAKS(false, "ab.", 2, 3);
+  ASSERT_BREAKS(false, "a", 1);
+}
+
+UTEST(utf8_word_break, including_utf8) {
+  // "naïve café" with a combining accent in café.
+  ASSERT_BREAKS(false, "na\xC3\xAFve cafe\xCC\x81", 6, 7, 13);
+  // Japanese: Katakana stays together (WB13), ideographs do not.
+  ASSERT_BREAKS(false, "\xE3\x82\xAB\xE3\x82\xBF\xE4\xB8\xAD\xE6\x96\x87", 6,
+                9, 12);
+  // Two flags (regional indicator pairs, WB15/WB16).
+  ASSERT_BREAKS(false,
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xAB\xF0\x9F\x87"
+                "\xB7",
+                8, 16);
+  // CR LF (WB3)
+  ASSERT_BREAKS(false, "a\r\nb", 1, 3, 4);
+}
+
+UTEST(utf8_word_break, invalid) {
+  set_utf8_lib_error(0);
+  ASSERT_BREAKS(false, "ab\xFF"
+                       "cd",
+                2, 3, 5);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  // Truncated symbol at the end of the text.
+  ASSERT_BREAKS(false, "ab \xE4\xB8", 2, 3, 5);
+  set_utf8_lib_error(0);
+  // Decodes above U+10FFFF.
+  ASSERT_BREAKS(false, "ab\xF5\x80\x80\x80"
+                       "cd",
+                2, 6, 8);
+  set_utf8_lib_error(0);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: line breaks                                             //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_line_break, ascii) {
+  ASSERT_BREAKS(true, "The quick (\"brown\") fox", 4, 10, 20, 23);
+  // LB13, LB25: No break before punctuation or within numbers.
+  ASSERT_BREAKS(true, "It costs $3.14, ok?", 3, 9, 16, 19);
+  // LB21: Break after hyphens.
+  ASSERT_BREAKS(true, "well-known", 5, 10);
+  // Leading spaces
+  ASSERT_BREAKS(true, "  x", 2, 3);
+}
+
+UTEST(utf8_line_break, mandatory) {
+  size_t got[8];
+  bool mandatory[8];
+  ASSERT_EQ(collect(true, "ab\ncd\r\nef", 0, got, mandatory), (size_t)3);
+  ASSERT_EQ(got[0], (size_t)3);
+  ASSERT_TRUE(mandatory[0]);
+  ASSERT_EQ(got[1], (size_t)7);
+  ASSERT_TRUE(mandatory[1]);
+  ASSERT_EQ(got[2], (size_t)9);
+  ASSERT_TRUE(mandatory[2]);
+}
+
+UTEST(utf8_line_break, including_utf8) {
+  // Every ideograph is a break opportunity, but not before "。" (LB13).
+  ASSERT_BREAKS(true, "\xE4\xB8\xAD\xE6\x96\x87\xE3\x80\x82", 3, 9);
+  // No break before combining marks (LB9).
+  ASSERT_BREAKS(true, "cafe\xCC\x81 ok", 7, 9);
+  // Non-breaking space (LB12, LB12a)
+  ASSERT_BREAKS(true, "10\xC2\xA0kg", 6);
+}
+
+UTEST_MAIN()
@@ -0,0 +1,236 @@
+#include "utf8_compact.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Bytes of the form 10XX_XXXX continue a symbol.
+#define IS_CONTINUATION(b) (((uint8_t)(b)&0xC0) == 0x80)
+
+// Number of symbols and the largest byte of s.
+static size_t scan(const uint8_t *const s, size_t len, uint8_t *max) {
+  size_t count = 0;
+  uint8_t m = 0;
+  size_t i = 0;
+#if defined(__SSE2__)
+  // Signed comparison: 0x80..0xBF are -128..-65.
+  const __m128i last_continuation = _mm_set1_epi8((char)0xBF);
+  __m128i vmax = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    vmax = _mm_max_epu8(vmax, v);
+    count += __builtin_popcount(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(v, last_continuation)));
+  }
+  uint8_t lanes[16];
+  _mm_storeu_si128((__m128i *)lanes, vmax);
+  for (int k = 0; k < 16; k++)
+    m = lanes[k] > m ? lanes[k] : m;
+#endif
+  for (; i < len; i++) {
+    count += !IS_CONTINUATION(s[i]);
+    m = s[i] > m ? s[i] : m;
+  }
+  *max = m;
+  return count;
+}
+
+// Decode a symbol which is not ASCII. Returns its length or 0 if it is
+// invalid.
+static inline int decode(const utf8_chr *const s, size_t len,
+                         utf8_code_pt *c) {
+  const int n = utf8_decode_next(s, len, c);
+  return n < 1 ? 0 : n;
+}
+
+static bool decode_1(const utf8_chr *const s, size_t len, uint8_t *out) {
+  const uint8_t *const b = (const uint8_t *)s;
+  for (size_t i = 0; i < len;) {
+#if defined(__SSE2__)
+    if (i + 16 <= len) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(b + i));
+      if (_mm_movemask_epi8(v) == 0) {
+        _mm_storeu_si128((__m128i *)out, v);
+        out += 16;
+        i += 16;
+        continue;
+      }
+    }
+#endif
+    if (b[i] < 0x80) {
+      *out++ = b[i++];
+      continue;
+    }
+    utf8_code_pt c;
+    const int n = decode(s + i, len - i, &c);
+    if (n == 0)
+      return false;
+    *out++ = (uint8_t)c;
+    i += n;
+  }
+  return true;
+}
+
+static bool decode_2(const utf8_chr *const s, size_t len, uint16_t *out) {
+  const uint8_t *const b = (const uint8_t *)s;
+  for (size_t i = 0; i < len;) {
+#if defined(__SSE2__)
+    if (i + 16 <= len) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(b + i));
+      if (_mm_movemask_epi8(v) == 0) {
+        const __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(out + 8), _mm_unpackhi_epi8(v, zero));
+        out += 16;
+        i += 16;
+        continue;
+      }
+    }
+#endif
+    if (b[i] < 0x80) {
+      *out++ = b[i++];
+      continue;
+    }
+    utf8_code_pt c;
+    const int n = decode(s + i, len - i, &c);
+    if (n == 0)
+      return false;
+    *out++ = (uint16_t)c;
+    i += n;
+  }
+  return true;
+}
+
+static bool decode_4(const utf8_chr *const s, size_t len, uint32_t *out) {
+  const uint8_t *const b = (const uint8_t *)s;
+  for (size_t i = 0; i < len;) {
+#if defined(__SSE2__)
+    if (i + 16 <= len) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(b + i));
+      if (_mm_movemask_epi8(v) == 0) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(out + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(out + 12), _mm_unpackhi_epi16(hi, zero));
+        out += 16;
+        i += 16;
+        continue;
+      }
+    }
+#endif
+    if (b[i] < 0x80) {
+      *out++ = b[i++];
+      continue;
+    }
+    utf8_code_pt c;
+    const int n = decode(s + i, len - i, &c);
+    if (n == 0)
+      return false;
+    *out++ = c;
+    i += n;
+  }
+  return true;
+}
+
+struct utf8_compact *utf8_compact_init(struct utf8_compact *a,
+                                       const utf8_chr *const s, size_t len) {
+  uint8_t max;
+  a->count = scan((const uint8_t *)s, len, &max);
+  // First bytes up to 0xC3 start symbols up to U+00FF, the ones up to 0xEF
+  // symbols up to U+FFFF.
+  a->width = max < 0xC4 ? 1 : max < 0xF0 ? 2 : 4;
+  // The SSE2 paths write 16 elements at a time, but only where 16 symbols
+  // follow, so count elements are enough.
+  a->data = malloc((a->count ? a->count : 1) * a->width);
+  if (!a->data)
+    return NULL;
+
+  bool ok;
+  if (a->width == 1)
+    ok = decode_1(s, len, a->data);
+  else if (a->width == 2)
+    ok = decode_2(s, len, a->data);
+  else
+    ok = decode_4(s, len, a->data);
+  if (!ok) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    free(a->data);
+    a->data = NULL;
+    return NULL;
+  }
+  return a;
+}
+
+void utf8_compact_free(struct utf8_compact *a) {
+  free(a->data);
+  a->data = NULL;
+  a->count = 0;
+}
+
+size_t utf8_compact_encoded_size(const struct utf8_compact *a) {
+  size_t size = 0;
+  for (size_t i = 0; i < a->count; i++) {
+    const utf8_code_pt c = utf8_compact_get(a, i);
+    size += 1 + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000);
+  }
+  return size;
+}
+
+#if defined(__SSE2__)
+// Store 16 codepoints of the width of a, starting at element i, as bytes if
+// they are all ASCII. Returns false otherwise.
+static inline bool store_ascii_16(const struct utf8_compact *a, size_t i,
+                                  utf8_chr *const dest) {
+  __m128i bytes;
+  if (a->width == 1) {
+    bytes = _mm_loadu_si128((const __m128i *)((const uint8_t *)a->data + i));
+  } else if (a->width == 2) {
+    const uint16_t *p = (const uint16_t *)a->data + i;
+    const __m128i lo = _mm_loadu_si128((const __m128i *)p);
+    const __m128i hi = _mm_loadu_si128((const __m128i *)(p + 8));
+    // The pack saturates signed elements, so U+8000 and above would become
+    // 0x00. Check for bits above ASCII before.
+    const __m128i high_bits = _mm_set1_epi16((short)0xFF80);
+    const __m128i ascii = _mm_cmpeq_epi16(
+        _mm_and_si128(_mm_or_si128(lo, hi), high_bits), _mm_setzero_si128());
+    if (_mm_movemask_epi8(ascii) != 0xFFFF)
+      return false;
+    bytes = _mm_packus_epi16(lo, hi);
+  } else {
+    const uint32_t *p = (const uint32_t *)a->data + i;
+    const __m128i lo =
+        _mm_packs_epi32(_mm_loadu_si128((const __m128i *)p),
+                        _mm_loadu_si128((const __m128i *)(p + 4)));
+    const __m128i hi =
+        _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(p + 8)),
+                        _mm_loadu_si128((const __m128i *)(p + 12)));
+    bytes = _mm_packus_epi16(lo, hi);
+  }
+  if (_mm_movemask_epi8(bytes) != 0)
+    return false;
+  _mm_storeu_si128((__m128i *)dest, bytes);
+  return true;
+}
+#endif
+
+size_t utf8_compact_encode(const struct utf8_compact *a, utf8_chr *const dest) {
+  size_t written = 0;
+  for (size_t i = 0; i < a->count;) {
+#if defined(__SSE2__)
+    if (i + 16 <= a->count && store_ascii_16(a, i, dest + written)) {
+      written += 16;
+      i += 16;
+      continue;
+    }
+#endif
+    written += utf8_from_codepoint(utf8_compact_get(a, i), dest + written);
+    i++;
+  }
+  return written;
+}
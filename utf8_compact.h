@@ -0,0 +1,55 @@
+#ifndef KL_UTF8_COMPACT_H
+#define KL_UTF8_COMPACT_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decoded codepoints of a string with O(1) access, stored with as few bytes
+// per codepoint as the largest one needs: 1 byte up to U+00FF, 2 bytes up to
+// U+FFFF and 4 bytes above.
+struct utf8_compact {
+  // count elements of type uint8_t, uint16_t or uint32_t.
+  void *data;
+  size_t count;
+  // Bytes per element: 1, 2 or 4.
+  int width;
+};
+
+// Decode len bytes of s. The width is chosen from the first bytes of the
+// symbols before anything is decoded, so s is decoded only once.
+// Returns NULL if memory could not be allocated. On invalid UTF-8, sets
+// utf8_lib_error and returns NULL.
+struct utf8_compact *utf8_compact_init(struct utf8_compact *a,
+                                       const utf8_chr *const s, size_t len);
+
+void utf8_compact_free(struct utf8_compact *a);
+
+// Codepoint i. i has to be less than a->count.
+static inline utf8_code_pt utf8_compact_get(const struct utf8_compact *a,
+                                            size_t i) {
+  switch (a->width) {
+  case 1:
+    return ((const uint8_t *)a->data)[i];
+  case 2:
+    return ((const uint16_t *)a->data)[i];
+  default:
+    return ((const uint32_t *)a->data)[i];
+  }
+}
+
+// Number of bytes utf8_compact_encode writes.
+size_t utf8_compact_encoded_size(const struct utf8_compact *a);
+
+// Encode the codepoints as UTF-8 into dest, which must have room for
+// utf8_compact_encoded_size(a) bytes. No terminating 0 is written.
+// Returns the number of bytes written.
+size_t utf8_compact_encode(const struct utf8_compact *a, utf8_chr *const dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_COMPACT_H
@@ -0,0 +1,86 @@
+#include "utest/utest.h"
+#include "utf8_compact.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+UTEST(utf8_compact, widths) {
+  struct utf8_compact a;
+  ASSERT_TRUE(utf8_compact_init(&a, U8(""), 0) != NULL);
+  ASSERT_EQ(a.count, (size_t)0);
+  ASSERT_EQ(a.width, 1);
+  utf8_compact_free(&a);
+
+  // "naïve" fits into 1 byte per codepoint.
+  ASSERT_TRUE(utf8_compact_init(&a, U8("na\xC3\xAFve"), 6) != NULL);
+  ASSERT_EQ(a.width, 1);
+  ASSERT_EQ(a.count, (size_t)5);
+  ASSERT_EQ(utf8_compact_get(&a, 2), (utf8_code_pt)0xEF);
+  ASSERT_EQ(utf8_compact_get(&a, 4), (utf8_code_pt)'e');
+  utf8_compact_free(&a);
+
+  // "aλ€"
+  ASSERT_TRUE(utf8_compact_init(&a, U8("a\xCE\xBB\xE2\x82\xAC"), 6) != NULL);
+  ASSERT_EQ(a.width, 2);
+  ASSERT_EQ(utf8_compact_get(&a, 1), (utf8_code_pt)0x3BB);
+  ASSERT_EQ(utf8_compact_get(&a, 2), (utf8_code_pt)0x20AC);
+  utf8_compact_free(&a);
+
+  ASSERT_TRUE(utf8_compact_init(&a, U8("a\xF0\x9F\x98\x80"), 5) != NULL);
+  ASSERT_EQ(a.width, 4);
+  ASSERT_EQ(utf8_compact_get(&a, 1), (utf8_code_pt)0x1F600);
+  utf8_compact_free(&a);
+}
+
+UTEST(utf8_compact, errors) {
+  struct utf8_compact a;
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(utf8_compact_init(&a, U8("abc\xE2\x82"), 5) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(utf8_compact_init(&a, U8("\x80"), 1) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  // Above U+10FFFF.
+  ASSERT_TRUE(utf8_compact_init(&a, U8("\xF5\x80\x80\x80"), 4) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+// Random strings with long ASCII runs, so both the block and the single
+// symbol paths run, decoded and encoded again.
+UTEST(utf8_compact, round_trip) {
+  static const utf8_code_pt widest[] = {0xE9, 0x3BB, 0x1F600};
+  utf8_code_pt cps[600];
+  utf8_chr s[2400], back[2400];
+  unsigned seed = 3;
+  for (int round = 0; round < 300; round++) {
+    const utf8_code_pt max = widest[round % 3];
+    size_t n = 0, len = 0;
+    seed = seed * 1103515245 + 12345;
+    const size_t total = (seed >> 16) % 600;
+    while (n < total) {
+      seed = seed * 1103515245 + 12345;
+      utf8_code_pt c = 'a' + (seed >> 16) % 26;
+      if ((seed >> 8) % 8 == 0)
+        c = 0x80 + (seed >> 12) % (max - 0x7F);
+      if (c >= 0xD800 && c < 0xE000)
+        c = 'x';
+      cps[n++] = c;
+      len += utf8_from_codepoint(c, s + len);
+    }
+
+    struct utf8_compact a;
+    ASSERT_TRUE(utf8_compact_init(&a, s, len) != NULL);
+    ASSERT_EQ(a.count, n);
+    for (size_t i = 0; i < n; i++)
+      ASSERT_EQ(utf8_compact_get(&a, i), cps[i]);
+    ASSERT_EQ(utf8_compact_encoded_size(&a), len);
+    ASSERT_EQ(utf8_compact_encode(&a, back), len);
+    ASSERT_EQ(memcmp(s, back, len), 0);
+    utf8_compact_free(&a);
+  }
+}
+
+UTEST_MAIN()
@@ -0,0 +1,239 @@
+#include "utf8_distance.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Bytes of the form 10XX_XXXX continue a symbol.
+#define IS_CONTINUATION(b) (((uint8_t)(b)&0xC0) == 0x80)
+
+// The string which is compared against others. Bit i of the mask of a
+// codepoint is set if codepoint i of the query is that codepoint.
+struct query {
+  size_t m;
+  size_t words;
+  // Masks of all codepoints of the query, `words` words each. Index 0 holds
+  // zero masks for codepoints which do not occur in the query.
+  uint64_t *eq;
+  uint32_t ascii[128];
+  // Open addressing table of the other codepoints. 0 marks an empty key.
+  utf8_code_pt *keys;
+  uint32_t *index;
+  size_t mask;
+  // Vertical deltas of the current column, `words` words each.
+  uint64_t *pv;
+  uint64_t *mv;
+};
+
+// Number of codepoints of valid UTF-8. Only counts, does not validate.
+static size_t count_codepoints(const utf8_chr *const s, size_t len) {
+  size_t n = 0;
+  for (size_t i = 0; i < len; i++)
+    n += !IS_CONTINUATION(s[i]);
+  return n;
+}
+
+static inline size_t slot_of(utf8_code_pt c, size_t mask) {
+  return (size_t)((c * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+static inline const uint64_t *query_eq(const struct query *q,
+                                       utf8_code_pt c) {
+  if (c < 128)
+    return q->eq + q->ascii[c] * q->words;
+  if (!q->keys)
+    return q->eq;
+  for (size_t i = slot_of(c, q->mask);; i = (i + 1) & q->mask) {
+    if (q->keys[i] == c)
+      return q->eq + q->index[i] * q->words;
+    if (q->keys[i] == 0)
+      return q->eq;
+  }
+}
+
+static void query_free(struct query *q) {
+  free(q->eq);
+  free(q->keys);
+  free(q->index);
+  free(q->pv);
+  free(q->mv);
+}
+
+// Returns false if memory could not be allocated or the query is invalid.
+static bool query_init(struct query *q, const utf8_chr *const s, size_t len) {
+  memset(q, 0, sizeof(struct query));
+
+  // Validate and count the codepoints outside of ASCII.
+  size_t wide = 0;
+  utf8_code_pt c;
+  for (size_t i = 0; i < len;) {
+    const int n = utf8_decode_next(s + i, len - i, &c);
+    if (n < 1) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      return false;
+    }
+    q->m++;
+    wide += c >= 128;
+    i += n;
+  }
+  q->words = (q->m + 63) / 64;
+
+  if (wide > 0) {
+    size_t size = 16;
+    while (size < 2 * wide)
+      size *= 2;
+    q->keys = calloc(size, sizeof(utf8_code_pt));
+    q->index = malloc(size * sizeof(uint32_t));
+    q->mask = size - 1;
+    if (!q->keys || !q->index)
+      goto fail;
+  }
+
+  // Give every distinct codepoint an index.
+  uint32_t symbols = 1;
+  for (size_t i = 0; i < len;) {
+    i += utf8_decode_next(s + i, len - i, &c);
+    if (c < 128) {
+      if (q->ascii[c] == 0)
+        q->ascii[c] = symbols++;
+      continue;
+    }
+    size_t j = slot_of(c, q->mask);
+    while (q->keys[j] != 0 && q->keys[j] != c)
+      j = (j + 1) & q->mask;
+    if (q->keys[j] == 0) {
+      q->keys[j] = c;
+      q->index[j] = symbols++;
+    }
+  }
+
+  const size_t words = q->words ? q->words : 1;
+  q->eq = calloc(symbols * words, sizeof(uint64_t));
+  q->pv = malloc(words * sizeof(uint64_t));
+  q->mv = malloc(words * sizeof(uint64_t));
+  if (!q->eq || !q->pv || !q->mv)
+    goto fail;
+
+  size_t pos = 0;
+  for (size_t i = 0; i < len; pos++) {
+    i += utf8_decode_next(s + i, len - i, &c);
+    uint64_t *eq = (uint64_t *)query_eq(q, c);
+    eq[pos / 64] |= (uint64_t)1 << (pos % 64);
+  }
+  return true;
+
+fail:
+  query_free(q);
+  return false;
+}
+
+// One step of a block of 64 rows, after Myers, "A fast bit-vector algorithm
+// for approximate string matching based on dynamic programming", 1999.
+// hin is the horizontal delta entering the block at its top, the result the
+// one leaving it at row `high`.
+static inline int advance_block(uint64_t *pv, uint64_t *mv, uint64_t eq,
+                                int hin, uint64_t high) {
+  const uint64_t xv = eq | *mv;
+  if (hin < 0)
+    eq |= 1;
+  const uint64_t xh = (((eq & *pv) + *pv) ^ *pv) | eq;
+  uint64_t ph = *mv | ~(xh | *pv);
+  uint64_t mh = *pv & xh;
+
+  const int hout = (ph & high) ? 1 : (mh & high) ? -1 : 0;
+  ph <<= 1;
+  mh <<= 1;
+  if (hin < 0)
+    mh |= 1;
+  else if (hin > 0)
+    ph |= 1;
+  *pv = mh | ~(xv | ph);
+  *mv = ph & xv;
+  return hout;
+}
+
+// Distance between the query and a string, or k + 1 if it is above k.
+static size_t query_distance(const struct query *q, const utf8_chr *const s,
+                             size_t len, size_t k) {
+  const size_t n = count_codepoints(s, len);
+  // The distance is never larger than the longer length, which also keeps
+  // the sums below from overflowing.
+  if (k > q->m && k > n)
+    k = q->m > n ? q->m : n;
+  if (n > q->m + k || q->m > n + k)
+    return k + 1;
+
+  for (size_t w = 0; w < q->words; w++) {
+    q->pv[w] = ~(uint64_t)0;
+    q->mv[w] = 0;
+  }
+  const uint64_t last_high = (uint64_t)1 << ((q->m + 63) % 64);
+
+  // score is the distance between the query and the first j codepoints of
+  // s. Every further codepoint changes it by at most 1.
+  size_t score = q->m;
+  size_t j = 0;
+  utf8_code_pt c;
+  for (size_t i = 0; i < len; j++) {
+    if ((uint8_t)s[i] < 0x80) {
+      c = (uint8_t)s[i++];
+    } else {
+      const int bytes = utf8_decode_next(s + i, len - i, &c);
+      if (bytes < 1) {
+        set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+        return SIZE_MAX;
+      }
+      i += bytes;
+    }
+
+    const uint64_t *eq = query_eq(q, c);
+    int h = 1;
+    for (size_t w = 0; w + 1 < q->words; w++)
+      h = advance_block(&q->pv[w], &q->mv[w], eq[w], h, (uint64_t)1 << 63);
+    if (q->words > 0)
+      h = advance_block(&q->pv[q->words - 1], &q->mv[q->words - 1],
+                        eq[q->words - 1], h, last_high);
+    score += h;
+
+    if (score > k + (n - j - 1))
+      return k + 1;
+  }
+  return score;
+}
+
+size_t utf8_levenshtein_bounded(const utf8_chr *const a, size_t alen,
+                                const utf8_chr *const b, size_t blen,
+                                size_t k) {
+  // The shorter string is the query, so there are fewer blocks per step.
+  const size_t an = count_codepoints(a, alen);
+  const size_t bn = count_codepoints(b, blen);
+  if (an > bn)
+    return utf8_levenshtein_bounded(b, blen, a, alen, k);
+  if (bn - an > k)
+    return k + 1;
+
+  struct query q;
+  if (!query_init(&q, a, alen))
+    return SIZE_MAX;
+  const size_t dist = query_distance(&q, b, blen, k);
+  query_free(&q);
+  return dist;
+}
+
+size_t utf8_levenshtein(const utf8_chr *const a, size_t alen,
+                        const utf8_chr *const b, size_t blen) {
+  return utf8_levenshtein_bounded(a, alen, b, blen, SIZE_MAX - 1);
+}
+
+bool utf8_levenshtein_batch(const utf8_chr *const query, size_t query_len,
+                            const utf8_chr *const *strs, const size_t *lens,
+                            size_t n, size_t k, size_t *dist) {
+  struct query q;
+  if (!query_init(&q, query, query_len))
+    return false;
+  if (k == SIZE_MAX)
+    k = SIZE_MAX - 1;
+  for (size_t i = 0; i < n; i++)
+    dist[i] = query_distance(&q, strs[i], lens[i], k);
+  query_free(&q);
+  return true;
+}
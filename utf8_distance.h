@@ -0,0 +1,45 @@
+#ifndef KL_UTF8_DISTANCE_H
+#define KL_UTF8_DISTANCE_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Levenshtein distance between two strings of alen and blen bytes, counted in
+// codepoints: the number of codepoints which have to be inserted, deleted or
+// replaced to turn one string into the other.
+//
+// Uses Myers' bit-parallel algorithm, which handles 64 codepoints of the
+// shorter string per step and decodes the longer one as it goes. Memory is
+// proportional to the length of the shorter string times the number of
+// distinct codepoints in it.
+//
+// Returns SIZE_MAX if memory could not be allocated. On invalid UTF-8, sets
+// utf8_lib_error and returns SIZE_MAX.
+size_t utf8_levenshtein(const utf8_chr *const a, size_t alen,
+                        const utf8_chr *const b, size_t blen);
+
+// Same as utf8_levenshtein, but returns k + 1 for every distance above k.
+// Stops as soon as the distance can no longer be k or less, and strings
+// whose lengths alone differ by more than k are rejected without being
+// decoded (and without being checked for invalid UTF-8).
+size_t utf8_levenshtein_bounded(const utf8_chr *const a, size_t alen,
+                                const utf8_chr *const b, size_t blen,
+                                size_t k);
+
+// Bounded distances between one query and n strings. dist[i] receives the
+// distance to strs[i] like utf8_levenshtein_bounded would return it. The
+// query is prepared only once. Pass SIZE_MAX as k to compute every distance.
+// Strings with invalid UTF-8 get SIZE_MAX and set utf8_lib_error.
+// Returns false if memory could not be allocated or the query is invalid.
+bool utf8_levenshtein_batch(const utf8_chr *const query, size_t query_len,
+                            const utf8_chr *const *strs, const size_t *lens,
+                            size_t n, size_t k, size_t *dist);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_DISTANCE_H
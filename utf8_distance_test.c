@@ -0,0 +1,123 @@
+#include "utest/utest.h"
+#include "utf8_distance.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+static size_t distance(const char *a, const char *b) {
+  return utf8_levenshtein(U8(a), strlen(a), U8(b), strlen(b));
+}
+
+UTEST(utf8_distance, examples) {
+  ASSERT_EQ(distance("", ""), (size_t)0);
+  ASSERT_EQ(distance("", "abc"), (size_t)3);
+  ASSERT_EQ(distance("abc", ""), (size_t)3);
+  ASSERT_EQ(distance("kitten", "sitting"), (size_t)3);
+  ASSERT_EQ(distance("flaw", "lawn"), (size_t)2);
+  // Codepoints, not bytes: "é" is two bytes but one edit.
+  ASSERT_EQ(distance("caf\xC3\xA9", "cafe"), (size_t)1);
+  ASSERT_EQ(distance("\xE6\x97\xA5\xE6\x9C\xAC", "\xE6\x97\xA5"), (size_t)1);
+  ASSERT_EQ(distance("\xF0\x9F\x98\x80", "\xF0\x9F\x98\x81"), (size_t)1);
+}
+
+UTEST(utf8_distance, bounded) {
+  const char *a = "kitten", *b = "sitting";
+  ASSERT_EQ(utf8_levenshtein_bounded(U8(a), 6, U8(b), 7, 3), (size_t)3);
+  ASSERT_EQ(utf8_levenshtein_bounded(U8(a), 6, U8(b), 7, 2), (size_t)3);
+  ASSERT_EQ(utf8_levenshtein_bounded(U8(a), 6, U8(b), 7, 0), (size_t)1);
+  ASSERT_EQ(utf8_levenshtein_bounded(U8(a), 6, U8(b), 7, SIZE_MAX),
+            (size_t)3);
+}
+
+UTEST(utf8_distance, errors) {
+  set_utf8_lib_error(0);
+  ASSERT_EQ(distance("ab\xC3", "abc"), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  ASSERT_EQ(distance("abc", "a\x80" "c"), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+
+  const utf8_chr *strs[] = {U8("abc"), U8("\xFF")};
+  const size_t lens[] = {3, 1};
+  size_t dist[2];
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(utf8_levenshtein_batch(U8("abd"), 3, strs, lens, 2, 5, dist));
+  ASSERT_EQ(dist[0], (size_t)1);
+  ASSERT_EQ(dist[1], SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  ASSERT_FALSE(utf8_levenshtein_batch(U8("\xC3"), 1, strs, lens, 2, 5, dist));
+}
+
+// Distance by the textbook dynamic program over decoded codepoints.
+static size_t naive(const utf8_code_pt *a, size_t m, const utf8_code_pt *b,
+                    size_t n) {
+  size_t *row = malloc((n + 1) * sizeof(size_t));
+  for (size_t j = 0; j <= n; j++)
+    row[j] = j;
+  for (size_t i = 1; i <= m; i++) {
+    size_t diag = row[0];
+    row[0] = i;
+    for (size_t j = 1; j <= n; j++) {
+      const size_t up = row[j];
+      size_t best = diag + (a[i - 1] != b[j - 1]);
+      if (up + 1 < best)
+        best = up + 1;
+      if (row[j - 1] + 1 < best)
+        best = row[j - 1] + 1;
+      row[j] = best;
+      diag = up;
+    }
+  }
+  const size_t res = row[n];
+  free(row);
+  return res;
+}
+
+// Random string of up to max codepoints from a small alphabet of 1 to 4 byte
+// symbols, so that matches are frequent.
+// Returns the number of codepoints, *len receives the number of bytes.
+static size_t random_string(unsigned *seed, size_t max, utf8_code_pt *cps,
+                            utf8_chr *s, size_t *len) {
+  static const utf8_code_pt alphabet[] = {'a', 'b', 'c', 0xE9, 0x3BB,
+                                          0x20AC, 0x1F600};
+  *seed = *seed * 1103515245 + 12345;
+  const size_t n = (*seed >> 16) % (max + 1);
+  *len = 0;
+  for (size_t i = 0; i < n; i++) {
+    *seed = *seed * 1103515245 + 12345;
+    cps[i] = alphabet[(*seed >> 16) % 7];
+    *len += utf8_from_codepoint(cps[i], s + *len);
+  }
+  return n;
+}
+
+UTEST(utf8_distance, naive) {
+  utf8_code_pt a_cps[200], b_cps[200];
+  utf8_chr a[800], b[800];
+  unsigned seed = 42;
+  for (int round = 0; round < 400; round++) {
+    // Short strings fit into one block, long ones need up to four.
+    const size_t max = round % 2 ? 20 : 200;
+    size_t alen, blen;
+    const size_t m = random_string(&seed, max, a_cps, a, &alen);
+    const size_t n = random_string(&seed, max, b_cps, b, &blen);
+
+    const size_t expected = naive(a_cps, m, b_cps, n);
+    ASSERT_EQ(utf8_levenshtein(a, alen, b, blen), expected);
+    for (size_t k = 0; k < 8; k++) {
+      const size_t bounded = utf8_levenshtein_bounded(a, alen, b, blen, k);
+      ASSERT_EQ(bounded, expected <= k ? expected : k + 1);
+    }
+
+    const utf8_chr *strs[] = {b, a};
+    const size_t lens[] = {blen, alen};
+    size_t dist[2];
+    ASSERT_TRUE(
+        utf8_levenshtein_batch(a, alen, strs, lens, 2, SIZE_MAX, dist));
+    ASSERT_EQ(dist[0], expected);
+    ASSERT_EQ(dist[1], (size_t)0);
+  }
+}
+
+UTEST_MAIN()
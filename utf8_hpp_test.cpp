@@ -0,0 +1,77 @@
+#include "utest/utest.h"
+#include "utf8.hpp"
+
+#include <cstring>
+
+namespace u8 = kl::utf8;
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: compile time                                            //
+//////////////////////////////////////////////////////////////////////
+
+static_assert(u8::codepoint_bytes(0x7F) == 1, "");
+static_assert(u8::codepoint_bytes(0x03BB) == 2, "");
+static_assert(u8::codepoint_bytes(0x2020) == 3, "");
+static_assert(u8::codepoint_bytes(0x1F600) == 4, "");
+static_assert(u8::codepoint_bytes(0x110000) == -1, "");
+
+static_assert(u8::to_codepoint("\xCE\xBB") == 0x03BB, "");
+static_assert(u8::to_codepoint("\xE2\x80\xA0") == 0x2020, "");
+static_assert(u8::to_codepoint("\xE2\xF0\xA0") == UINT32_MAX, "");
+static_assert(u8::to_codepoint("\x8F") == UINT32_MAX, "");
+
+static_assert(u8::encode<0x03BB>()[0] == '\xCE', "");
+static_assert(u8::encode<0x03BB>()[1] == '\xBB', "");
+static_assert(u8::encode<0x03BB>()[2] == 0, "");
+static_assert(u8::to_codepoint(u8::encode<0x10FFFF>().data()) == 0x10FFFF, "");
+
+static_assert(u8::string_valid("ABC\xE2\x80\xA0"), "");
+static_assert(!u8::string_valid("ABC\xFF"), "");
+static_assert(!u8::string_valid("\xE2\x80"), "");
+
+#if __cplusplus >= 202002L
+static constexpr u8::literal lambda = "\xCE\xBBx.x";
+static_assert(lambda.size() == 5, "");
+static_assert(u8::to_codepoint(lambda.c_str()) == 0x03BB, "");
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: runtime equivalence                                     //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_hpp, sequence_length_table) {
+  for (int b = 0; b < 256; b++) {
+    ASSERT_EQ(u8::sequence_length_table[b], utf8_sequence_length_table[b]);
+    ASSERT_EQ(u8::num_bytes_in_next_symbol((utf8_chr)b),
+              utf8_num_bytes_in_next_symbol((utf8_chr)b, false));
+  }
+}
+
+UTEST(utf8_hpp, from_and_to_codepoint) {
+  for (utf8_code_pt c = 0; c <= UNICODE_MAX_CODEPT + 1; c += 7) {
+    utf8_chr b1[5] = {0};
+    utf8_chr b2[5] = {0};
+    const int n1 = u8::from_codepoint(c, b1);
+    const int n2 = utf8_from_codepoint(c, b2);
+    ASSERT_EQ(n1, n2);
+    ASSERT_EQ(u8::codepoint_bytes(c), utf8_codepoint_bytes(c));
+    if (n2 < 1)
+      continue;
+    ASSERT_EQ(0, memcmp(b1, b2, sizeof(b1)));
+    ASSERT_EQ(u8::to_codepoint(b1), utf8_to_codepoint(b2));
+    ASSERT_EQ(u8::string_valid(b1), utf8_string_valid(b2));
+  }
+}
+
+UTEST(utf8_hpp, invalid_sequences) {
+  const char *cases[] = {"\x80", "\xC0", "\xE2\x80", "\xE2\xF0\xA0",
+                         "\xF8\x80\x80\x80", "A\xFF", "\xF0\x8F\x8F\x8F"};
+  for (const char *s : cases) {
+    const utf8_chr *b = utf8_reinterpret_string(s);
+    ASSERT_EQ(u8::string_valid(b), utf8_string_valid(b));
+    ASSERT_EQ(u8::char_valid(b), utf8_char_valid(b));
+    ASSERT_EQ(u8::to_codepoint(b), utf8_to_codepoint(b));
+  }
+}
+
+UTEST_MAIN()
@@ -0,0 +1,244 @@
+#include "utf8_intern.h"
+#include "kl_hash.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define INITIAL_SLOTS 1024
+#define CHUNK_SIZE 65536
+
+struct utf8_intern_chunk {
+  struct utf8_intern_chunk *prev;
+  utf8_chr data[];
+};
+
+// The slot of a string holds the upper half of its hash and its handle + 1,
+// so that an empty slot is 0. The lower half of the hash selects the slot.
+#define SLOT(hash, handle) (((hash) & 0xFFFFFFFF00000000ULL) | ((handle) + 1))
+#define SLOT_HANDLE(slot) ((uint32_t)(slot)-1)
+#define SLOT_TAG_MATCHES(slot, hash) ((((slot) ^ (hash)) >> 32) == 0)
+
+static struct utf8_intern_table *table_alloc(size_t slots) {
+  struct utf8_intern_table *t =
+      malloc(sizeof(*t) + slots * sizeof(_Atomic uint64_t));
+  if (!t)
+    return NULL;
+  t->mask = slots - 1;
+  t->retired = NULL;
+  for (size_t i = 0; i < slots; i++)
+    atomic_init(&t->slots[i], 0);
+  return t;
+}
+
+// Segment of a handle. *pos receives the position in the segment.
+static inline int segment_of(uint32_t handle, size_t *pos) {
+  const uint64_t n = (uint64_t)handle + UTF8_INTERN_SEGMENT0;
+  const int top = 63 - __builtin_clzll(n);
+  *pos = n - ((uint64_t)1 << top);
+  return top - __builtin_ctz(UTF8_INTERN_SEGMENT0);
+}
+
+static inline struct utf8_intern_entry *
+entry_ptr(struct utf8_intern_entry *const *segments, uint32_t handle) {
+  size_t pos;
+  const int segment = segment_of(handle, &pos);
+  return &segments[segment][pos];
+}
+
+struct utf8_intern_pool *utf8_intern_init(struct utf8_intern_pool *pool) {
+  struct utf8_intern_table *t = table_alloc(INITIAL_SLOTS);
+  if (!t)
+    return NULL;
+  atomic_init(&pool->table, t);
+  atomic_init(&pool->count, 0);
+  memset(pool->segments, 0, sizeof(pool->segments));
+  pool->chunk = NULL;
+  pool->chunk_used = 0;
+  pool->chunk_size = 0;
+  return pool;
+}
+
+void utf8_intern_free(struct utf8_intern_pool *pool) {
+  struct utf8_intern_table *t = atomic_load(&pool->table);
+  while (t) {
+    struct utf8_intern_table *retired = t->retired;
+    free(t);
+    t = retired;
+  }
+  for (int i = 0; i < UTF8_INTERN_SEGMENTS; i++)
+    free(pool->segments[i]);
+  struct utf8_intern_chunk *c = pool->chunk;
+  while (c) {
+    struct utf8_intern_chunk *prev = c->prev;
+    free(c);
+    c = prev;
+  }
+  atomic_store(&pool->table, NULL);
+  pool->chunk = NULL;
+}
+
+// Strict check: utf8_decode_next rejects overlong forms, surrogates and
+// codepoints above U+10FFFF. utf8_string_valid can not be used here because
+// it stops at the first zero byte.
+static bool valid_utf8(const utf8_chr *const s, size_t len) {
+  utf8_code_pt c;
+  for (size_t i = 0; i < len;) {
+    if ((uint8_t)s[i] < 0x80) {
+      i++;
+      continue;
+    }
+    const int n = utf8_decode_next(s + i, len - i, &c);
+    if (n < 0)
+      return false;
+    i += n;
+  }
+  return true;
+}
+
+// Copy a string into the arena.
+static const utf8_chr *arena_add(struct utf8_intern_pool *pool,
+                                 const utf8_chr *const s, size_t len) {
+  if (pool->chunk_size - pool->chunk_used < len + 1) {
+    // Long strings get a chunk of their own, behind the current one, so the
+    // rest of the current chunk is not wasted.
+    const bool own = len + 1 > CHUNK_SIZE / 4 && pool->chunk;
+    const size_t size = own || len + 1 > CHUNK_SIZE ? len + 1 : CHUNK_SIZE;
+    struct utf8_intern_chunk *c = malloc(sizeof(*c) + size);
+    if (!c)
+      return NULL;
+    if (own) {
+      c->prev = pool->chunk->prev;
+      pool->chunk->prev = c;
+      memcpy(c->data, s, len);
+      c->data[len] = 0;
+      return c->data;
+    }
+    c->prev = pool->chunk;
+    pool->chunk = c;
+    pool->chunk_used = 0;
+    pool->chunk_size = size;
+  }
+  utf8_chr *dst = pool->chunk->data + pool->chunk_used;
+  memcpy(dst, s, len);
+  dst[len] = 0;
+  pool->chunk_used += len + 1;
+  return dst;
+}
+
+// Move all strings into a table of twice the size. Only called by the
+// writer. The old table stays valid for readers which are still using it.
+static struct utf8_intern_table *grow(struct utf8_intern_pool *pool,
+                                      struct utf8_intern_table *old) {
+  struct utf8_intern_table *t = table_alloc((old->mask + 1) * 2);
+  if (!t)
+    return NULL;
+  for (size_t i = 0; i <= old->mask; i++) {
+    const uint64_t slot =
+        atomic_load_explicit(&old->slots[i], memory_order_relaxed);
+    if (slot == 0)
+      continue;
+    const struct utf8_intern_entry *e =
+        entry_ptr(pool->segments, SLOT_HANDLE(slot));
+    size_t j = kl_hash(e->str, e->len, 0) & t->mask;
+    while (atomic_load_explicit(&t->slots[j], memory_order_relaxed) != 0)
+      j = (j + 1) & t->mask;
+    atomic_store_explicit(&t->slots[j], slot, memory_order_relaxed);
+  }
+  t->retired = old;
+  atomic_store_explicit(&pool->table, t, memory_order_release);
+  return t;
+}
+
+uint32_t utf8_intern(struct utf8_intern_pool *pool, const utf8_chr *const s,
+                     size_t len) {
+  if (!valid_utf8(s, len)) {
+    set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    return UTF8_INTERN_NONE;
+  }
+
+  const uint64_t hash = kl_hash(s, len, 0);
+  struct utf8_intern_table *t =
+      atomic_load_explicit(&pool->table, memory_order_relaxed);
+  size_t i = hash & t->mask;
+  for (;; i = (i + 1) & t->mask) {
+    const uint64_t slot =
+        atomic_load_explicit(&t->slots[i], memory_order_relaxed);
+    if (slot == 0)
+      break;
+    if (SLOT_TAG_MATCHES(slot, hash)) {
+      const struct utf8_intern_entry *e =
+          entry_ptr(pool->segments, SLOT_HANDLE(slot));
+      if (e->len == len && memcmp(e->str, s, len) == 0)
+        return SLOT_HANDLE(slot);
+    }
+  }
+
+  const uint32_t handle =
+      atomic_load_explicit(&pool->count, memory_order_relaxed);
+  size_t pos;
+  const int segment = segment_of(handle, &pos);
+  if (segment >= UTF8_INTERN_SEGMENTS)
+    return UTF8_INTERN_NONE;
+
+  // Keep the table at most half full.
+  if (((size_t)handle + 1) * 2 > t->mask + 1) {
+    t = grow(pool, t);
+    if (!t)
+      return UTF8_INTERN_NONE;
+    i = hash & t->mask;
+    while (atomic_load_explicit(&t->slots[i], memory_order_relaxed) != 0)
+      i = (i + 1) & t->mask;
+  }
+
+  if (!pool->segments[segment]) {
+    const size_t n = (size_t)UTF8_INTERN_SEGMENT0 << segment;
+    pool->segments[segment] = malloc(n * sizeof(struct utf8_intern_entry));
+    if (!pool->segments[segment])
+      return UTF8_INTERN_NONE;
+  }
+
+  const utf8_chr *copy = arena_add(pool, s, len);
+  if (!copy)
+    return UTF8_INTERN_NONE;
+  struct utf8_intern_entry *e = &pool->segments[segment][pos];
+  e->str = copy;
+  e->len = len;
+
+  // Publish the entry. Readers which see the slot also see the entry.
+  atomic_store_explicit(&t->slots[i], SLOT(hash, handle),
+                        memory_order_release);
+  atomic_store_explicit(&pool->count, handle + 1, memory_order_release);
+  return handle;
+}
+
+uint32_t utf8_intern_lookup(const struct utf8_intern_pool *pool,
+                            const utf8_chr *const s, size_t len) {
+  const uint64_t hash = kl_hash(s, len, 0);
+  struct utf8_intern_table *t =
+      atomic_load_explicit(&pool->table, memory_order_acquire);
+  for (size_t i = hash & t->mask;; i = (i + 1) & t->mask) {
+    const uint64_t slot =
+        atomic_load_explicit(&t->slots[i], memory_order_acquire);
+    if (slot == 0)
+      return UTF8_INTERN_NONE;
+    if (SLOT_TAG_MATCHES(slot, hash)) {
+      const struct utf8_intern_entry *e =
+          entry_ptr(pool->segments, SLOT_HANDLE(slot));
+      if (e->len == len && memcmp(e->str, s, len) == 0)
+        return SLOT_HANDLE(slot);
+    }
+  }
+}
+
+const utf8_chr *utf8_intern_str(const struct utf8_intern_pool *pool,
+                                uint32_t handle) {
+  return entry_ptr(pool->segments, handle)->str;
+}
+
+size_t utf8_intern_len(const struct utf8_intern_pool *pool, uint32_t handle) {
+  return entry_ptr(pool->segments, handle)->len;
+}
+
+uint32_t utf8_intern_count(const struct utf8_intern_pool *pool) {
+  return atomic_load_explicit(&pool->count, memory_order_acquire);
+}
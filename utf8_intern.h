@@ -0,0 +1,89 @@
+#ifndef KL_UTF8_INTERN_H
+#define KL_UTF8_INTERN_H
+
+#include "utf8.h"
+
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returned instead of a handle if a string is not in the pool or could not
+// be added.
+#define UTF8_INTERN_NONE UINT32_MAX
+
+// Number of segments of the handle table. Segment i holds
+// UTF8_INTERN_SEGMENT0 << i strings.
+#define UTF8_INTERN_SEGMENTS 24
+#define UTF8_INTERN_SEGMENT0 256
+
+// Stores every distinct string once. Interned strings are identified by small
+// integer handles, which count up from 0, or by their address. Both stay
+// valid until the pool is freed, so two interned strings are equal if and
+// only if their handles (or pointers) are equal.
+//
+// Strings are copied into an append-only arena and are 0-terminated. The
+// index is an open addressing table with linear probing over 64 bit slots,
+// each holding 32 bits of the hash and the handle.
+//
+// utf8_intern_lookup, utf8_intern_str and utf8_intern_len can be called from
+// any number of threads at the same time, also while another thread adds
+// strings. utf8_intern must not be called from two threads at once.
+struct utf8_intern_entry {
+  const utf8_chr *str;
+  size_t len;
+};
+
+struct utf8_intern_chunk;
+
+struct utf8_intern_table {
+  size_t mask;
+  // Retired tables are kept until the pool is freed, because readers may
+  // still be probing them.
+  struct utf8_intern_table *retired;
+  _Atomic uint64_t slots[];
+};
+
+struct utf8_intern_pool {
+  _Atomic(struct utf8_intern_table *) table;
+  _Atomic uint32_t count;
+  struct utf8_intern_entry *segments[UTF8_INTERN_SEGMENTS];
+
+  // Arena. Strings are appended to the current chunk, which links to the
+  // previous ones.
+  struct utf8_intern_chunk *chunk;
+  size_t chunk_used;
+  size_t chunk_size;
+};
+
+// Returns NULL if memory could not be allocated.
+struct utf8_intern_pool *utf8_intern_init(struct utf8_intern_pool *pool);
+
+void utf8_intern_free(struct utf8_intern_pool *pool);
+
+// Handle of a string, which is added if it is not in the pool yet.
+// Returns UTF8_INTERN_NONE and sets utf8_lib_error if s is not valid UTF-8.
+// Also returns UTF8_INTERN_NONE if memory could not be allocated.
+uint32_t utf8_intern(struct utf8_intern_pool *pool, const utf8_chr *const s,
+                     size_t len);
+
+// Handle of a string, or UTF8_INTERN_NONE if it is not in the pool.
+uint32_t utf8_intern_lookup(const struct utf8_intern_pool *pool,
+                            const utf8_chr *const s, size_t len);
+
+// The interned copy of a string. The handle must have been returned by
+// utf8_intern or utf8_intern_lookup.
+const utf8_chr *utf8_intern_str(const struct utf8_intern_pool *pool,
+                                uint32_t handle);
+
+size_t utf8_intern_len(const struct utf8_intern_pool *pool, uint32_t handle);
+
+// Number of strings in the pool.
+uint32_t utf8_intern_count(const struct utf8_intern_pool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_INTERN_H
@@ -0,0 +1,130 @@
+#include "utest/utest.h"
+#include "utf8_intern.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+UTEST(utf8_intern, small) {
+  struct utf8_intern_pool pool;
+  ASSERT_TRUE(utf8_intern_init(&pool) != NULL);
+
+  const uint32_t a = utf8_intern(&pool, U8("\xCE\xBB"), 2);
+  const uint32_t b = utf8_intern(&pool, U8("lambda"), 6);
+  ASSERT_EQ(a, (uint32_t)0);
+  ASSERT_EQ(b, (uint32_t)1);
+  ASSERT_EQ(utf8_intern(&pool, U8("\xCE\xBB"), 2), a);
+  ASSERT_EQ(utf8_intern(&pool, U8("lambda!"), 6), b);
+  ASSERT_EQ(utf8_intern_count(&pool), (uint32_t)2);
+
+  ASSERT_EQ(utf8_intern_lookup(&pool, U8("lambda"), 6), b);
+  ASSERT_EQ(utf8_intern_lookup(&pool, U8("lambd"), 5), UTF8_INTERN_NONE);
+  ASSERT_EQ(utf8_intern_len(&pool, a), (size_t)2);
+  ASSERT_STREQ(utf8_intern_str(&pool, b), "lambda");
+
+  // Empty strings and embedded zeros are fine.
+  const uint32_t empty = utf8_intern(&pool, U8(""), 0);
+  const uint32_t zero = utf8_intern(&pool, U8("a\0b"), 3);
+  ASSERT_NE(empty, zero);
+  ASSERT_EQ(utf8_intern_lookup(&pool, U8("a\0b"), 3), zero);
+  ASSERT_EQ(utf8_intern_lookup(&pool, U8("a"), 1), UTF8_INTERN_NONE);
+
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_intern(&pool, U8("\xE2\x82"), 2), UTF8_INTERN_NONE);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+
+  // Overlong forms, surrogates and codepoints above U+10FFFF are not valid.
+  static const char *const bad[] = {"\xC0\xAF", "\xE0\x80\xAF",
+                                    "\xED\xA0\x80", "\xF4\x90\x80\x80"};
+  for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    set_utf8_lib_error(0);
+    ASSERT_EQ(utf8_intern(&pool, U8(bad[i]), strlen(bad[i])),
+              UTF8_INTERN_NONE);
+    ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  }
+  ASSERT_EQ(utf8_intern_count(&pool), (uint32_t)4);
+
+  utf8_intern_free(&pool);
+}
+
+UTEST(utf8_intern, many) {
+  // Enough strings to grow the table and fill several segments and chunks.
+  struct utf8_intern_pool pool;
+  char buf[64];
+  const int n = 100000;
+  ASSERT_TRUE(utf8_intern_init(&pool) != NULL);
+
+  const utf8_chr *first = NULL;
+  for (int i = 0; i < n; i++) {
+    const int len = snprintf(buf, sizeof(buf), "\xCE\xBB%d", i);
+    ASSERT_EQ(utf8_intern(&pool, U8(buf), len), (uint32_t)i);
+    if (i == 0)
+      first = utf8_intern_str(&pool, 0);
+  }
+  // A long string gets its own chunk.
+  char *long_str = malloc(100000);
+  memset(long_str, 'x', 100000);
+  const uint32_t l = utf8_intern(&pool, U8(long_str), 100000);
+  ASSERT_EQ(l, (uint32_t)n);
+
+  ASSERT_EQ(utf8_intern_count(&pool), (uint32_t)n + 1);
+  ASSERT_TRUE(utf8_intern_str(&pool, 0) == first);
+  for (int i = 0; i < n; i++) {
+    const int len = snprintf(buf, sizeof(buf), "\xCE\xBB%d", i);
+    ASSERT_EQ(utf8_intern_lookup(&pool, U8(buf), len), (uint32_t)i);
+    ASSERT_EQ(utf8_intern(&pool, U8(buf), len), (uint32_t)i);
+    ASSERT_EQ(0, memcmp(utf8_intern_str(&pool, i), buf, len + 1));
+  }
+  ASSERT_EQ(utf8_intern_lookup(&pool, U8(long_str), 100000), l);
+  ASSERT_EQ(0, memcmp(utf8_intern_str(&pool, l), long_str, 100000));
+  free(long_str);
+  utf8_intern_free(&pool);
+}
+
+struct reader_arg {
+  struct utf8_intern_pool *pool;
+  int errors;
+};
+
+// Every string which was added must be found with its handle.
+static void *reader(void *p) {
+  struct reader_arg *arg = p;
+  char buf[32];
+  for (int round = 0; round < 200; round++) {
+    const uint32_t count = utf8_intern_count(arg->pool);
+    for (uint32_t i = 0; i < count; i += 7) {
+      const int len = snprintf(buf, sizeof(buf), "id%u", (unsigned)i);
+      const uint32_t h = utf8_intern_lookup(arg->pool, U8(buf), len);
+      if (h != i || memcmp(utf8_intern_str(arg->pool, h), buf, len) != 0)
+        arg->errors++;
+    }
+  }
+  return NULL;
+}
+
+UTEST(utf8_intern, concurrent_readers) {
+  struct utf8_intern_pool pool;
+  struct reader_arg args[4];
+  pthread_t threads[4];
+  char buf[32];
+  ASSERT_TRUE(utf8_intern_init(&pool) != NULL);
+
+  for (int t = 0; t < 4; t++) {
+    args[t].pool = &pool;
+    args[t].errors = 0;
+    pthread_create(&threads[t], NULL, reader, &args[t]);
+  }
+  for (unsigned i = 0; i < 50000; i++) {
+    const int len = snprintf(buf, sizeof(buf), "id%u", i);
+    ASSERT_EQ(utf8_intern(&pool, U8(buf), len), (uint32_t)i);
+  }
+  for (int t = 0; t < 4; t++) {
+    pthread_join(threads[t], NULL);
+    ASSERT_EQ(args[t].errors, 0);
+  }
+  utf8_intern_free(&pool);
+}
+
+UTEST_MAIN()
@@ -0,0 +1,176 @@
+#include "utf8_line_index.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define STRIDE UTF8_LINE_INDEX_STRIDE
+
+// Bytes of the form 10XX_XXXX continue a symbol. All others start one.
+#define IS_LEAD(b) (((uint8_t)(b)&0xC0) != 0x80)
+
+static bool push_line(struct utf8_line_index *idx, size_t *reserved,
+                      size_t start) {
+  if (idx->line_count == *reserved) {
+    *reserved *= 2;
+    size_t *temp = realloc(idx->line_starts, *reserved * sizeof(size_t));
+    if (!temp)
+      return false;
+    idx->line_starts = temp;
+  }
+  idx->line_starts[idx->line_count++] = start;
+  return true;
+}
+
+struct utf8_line_index *utf8_line_index_init(struct utf8_line_index *idx,
+                                             const utf8_chr *const text,
+                                             size_t len) {
+  const uint8_t *const s = (const uint8_t *)text;
+  size_t reserved = 16;
+
+  idx->text = text;
+  idx->len = len;
+  idx->line_count = 0;
+  idx->line_starts = malloc(reserved * sizeof(size_t));
+  idx->checkpoints = malloc((len / STRIDE + 1) * sizeof(size_t));
+  if (!idx->line_starts || !idx->checkpoints || !push_line(idx, &reserved, 0))
+    goto error;
+
+  size_t column = 0;
+  size_t i = 0;
+
+#if defined(__SSE2__)
+  const __m128i newline = _mm_set1_epi8('\n');
+  // Signed comparison: 0x80..0xBF are -128..-65.
+  const __m128i last_continuation = _mm_set1_epi8((char)0xBF);
+  for (; i + 16 <= len; i += 16) {
+    if (i % STRIDE == 0)
+      idx->checkpoints[i / STRIDE] = column;
+
+    const __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    unsigned lead =
+        (unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(v, last_continuation));
+    unsigned lines = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, newline));
+
+    if (lines != 0) {
+      unsigned last = 0;
+      while (lines != 0) {
+        last = (unsigned)__builtin_ctz(lines);
+        if (!push_line(idx, &reserved, i + last + 1))
+          goto error;
+        lines &= lines - 1;
+      }
+      // Only symbols after the last newline are on the current line.
+      lead &= ~((2U << last) - 1);
+      column = 0;
+    }
+    column += (size_t)__builtin_popcount(lead);
+  }
+#endif
+
+  for (; i < len; i++) {
+    if (i % STRIDE == 0)
+      idx->checkpoints[i / STRIDE] = column;
+    if (s[i] == '\n') {
+      if (!push_line(idx, &reserved, i + 1))
+        goto error;
+      column = 0;
+    } else if (IS_LEAD(s[i])) {
+      column++;
+    }
+  }
+  if (len % STRIDE == 0)
+    idx->checkpoints[len / STRIDE] = column;
+
+  return idx;
+
+error:
+  utf8_line_index_free(idx);
+  return NULL;
+}
+
+void utf8_line_index_free(struct utf8_line_index *idx) {
+  free(idx->line_starts);
+  free(idx->checkpoints);
+  idx->line_starts = NULL;
+  idx->checkpoints = NULL;
+  idx->line_count = 0;
+}
+
+// Number of symbols starting in s[from..to).
+static size_t count_leads(const uint8_t *const s, size_t from, size_t to) {
+  size_t count = 0;
+  for (size_t i = from; i < to; i++)
+    count += IS_LEAD(s[i]);
+  return count;
+}
+
+// Index of the last line starting at or before offset.
+static size_t find_line(const struct utf8_line_index *idx, size_t offset) {
+  size_t lo = 0;
+  size_t hi = idx->line_count;
+  while (hi - lo > 1) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (idx->line_starts[mid] <= offset)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+bool utf8_line_index_position(const struct utf8_line_index *idx, size_t offset,
+                              size_t *line, size_t *column) {
+  if (offset > idx->len)
+    return false;
+
+  const size_t l = find_line(idx, offset);
+  const size_t start = idx->line_starts[l];
+  const size_t k = offset / STRIDE;
+  const uint8_t *const s = (const uint8_t *)idx->text;
+
+  *line = l;
+  if (k * STRIDE >= start)
+    *column = idx->checkpoints[k] + count_leads(s, k * STRIDE, offset);
+  else
+    *column = count_leads(s, start, offset);
+  return true;
+}
+
+size_t utf8_line_index_offset(const struct utf8_line_index *idx, size_t line,
+                              size_t column) {
+  if (line >= idx->line_count)
+    return SIZE_MAX;
+
+  const uint8_t *const s = (const uint8_t *)idx->text;
+  const size_t start = idx->line_starts[line];
+  const size_t end =
+      line + 1 < idx->line_count ? idx->line_starts[line + 1] - 1 : idx->len;
+
+  // Last checkpoint in the line with a column not above the wanted one.
+  size_t pos = start;
+  size_t col = 0;
+  size_t lo = (start + STRIDE - 1) / STRIDE;
+  size_t hi = end / STRIDE + 1;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (idx->checkpoints[mid] <= column) {
+      pos = mid * STRIDE;
+      col = idx->checkpoints[mid];
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  for (; pos < end; pos++) {
+    if (IS_LEAD(s[pos])) {
+      if (col == column)
+        return pos;
+      col++;
+    }
+  }
+  return col == column ? end : SIZE_MAX;
+}
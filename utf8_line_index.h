@@ -0,0 +1,51 @@
+#ifndef KL_UTF8_LINE_INDEX_H
+#define KL_UTF8_LINE_INDEX_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Every UTF8_LINE_INDEX_STRIDE bytes, the index stores the column at that
+// offset. Lookups never count more than this many bytes.
+#define UTF8_LINE_INDEX_STRIDE 256
+
+// Maps byte offsets to lines and columns and back. Lines end with '\n'.
+// Lines and columns start at 0. Columns are counted in codepoints.
+// The text is not copied and has to outlive the index.
+struct utf8_line_index {
+  const utf8_chr *text;
+  size_t len;
+  // Byte offset of the first byte of each line.
+  size_t *line_starts;
+  size_t line_count;
+  // Column of offset i * UTF8_LINE_INDEX_STRIDE within its line.
+  size_t *checkpoints;
+};
+
+// Build the index in one pass over text. Returns NULL if memory could not be
+// allocated.
+struct utf8_line_index *utf8_line_index_init(struct utf8_line_index *idx,
+                                             const utf8_chr *const text,
+                                             size_t len);
+
+void utf8_line_index_free(struct utf8_line_index *idx);
+
+// Line and column of a byte offset. Offsets inside of a symbol get the column
+// of the symbol after it. Offset len is allowed.
+// Returns false if offset is out of range.
+bool utf8_line_index_position(const struct utf8_line_index *idx, size_t offset,
+                              size_t *line, size_t *column);
+
+// Byte offset of a line and column. The column after the last symbol of a
+// line is allowed.
+// Returns SIZE_MAX if line or column is out of range.
+size_t utf8_line_index_offset(const struct utf8_line_index *idx, size_t line,
+                              size_t column);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_LINE_INDEX_H
@@ -0,0 +1,97 @@
+#include "utest/utest.h"
+#include "utf8_line_index.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+UTEST(utf8_line_index, small) {
+  // "λx\nab\n\n€"
+  const char *s = "\xCE\xBBx\nab\n\n\xE2\x82\xAC";
+  struct utf8_line_index idx;
+  size_t line, column;
+
+  ASSERT_TRUE(utf8_line_index_init(&idx, U8(s), strlen(s)) != NULL);
+  ASSERT_EQ(idx.line_count, (size_t)4);
+
+  ASSERT_TRUE(utf8_line_index_position(&idx, 0, &line, &column));
+  ASSERT_EQ(line, (size_t)0);
+  ASSERT_EQ(column, (size_t)0);
+  ASSERT_TRUE(utf8_line_index_position(&idx, 2, &line, &column));
+  ASSERT_EQ(line, (size_t)0);
+  ASSERT_EQ(column, (size_t)1);
+  ASSERT_TRUE(utf8_line_index_position(&idx, 5, &line, &column));
+  ASSERT_EQ(line, (size_t)1);
+  ASSERT_EQ(column, (size_t)1);
+  ASSERT_TRUE(utf8_line_index_position(&idx, 7, &line, &column));
+  ASSERT_EQ(line, (size_t)2);
+  ASSERT_EQ(column, (size_t)0);
+  ASSERT_TRUE(utf8_line_index_position(&idx, strlen(s), &line, &column));
+  ASSERT_EQ(line, (size_t)3);
+  ASSERT_EQ(column, (size_t)1);
+  ASSERT_FALSE(utf8_line_index_position(&idx, strlen(s) + 1, &line, &column));
+
+  ASSERT_EQ(utf8_line_index_offset(&idx, 0, 1), (size_t)2);
+  ASSERT_EQ(utf8_line_index_offset(&idx, 0, 2), (size_t)3);
+  ASSERT_EQ(utf8_line_index_offset(&idx, 0, 3), SIZE_MAX);
+  ASSERT_EQ(utf8_line_index_offset(&idx, 2, 0), (size_t)7);
+  ASSERT_EQ(utf8_line_index_offset(&idx, 3, 1), strlen(s));
+  ASSERT_EQ(utf8_line_index_offset(&idx, 4, 0), SIZE_MAX);
+
+  utf8_line_index_free(&idx);
+}
+
+UTEST(utf8_line_index, long_lines) {
+  // Lines of different lengths (some longer than the stride) with symbols
+  // of 1 to 4 bytes.
+  const char *symbols[] = {"a", "\xCE\xBB", "\xE2\x82\xAC",
+                           "\xF0\x9F\x98\x80"};
+  const size_t cap = 40000;
+  char *s = malloc(cap);
+  size_t *lines = malloc(cap * sizeof(size_t));
+  size_t *columns = malloc(cap * sizeof(size_t));
+  size_t len = 0;
+  size_t line = 0;
+  size_t column = 0;
+  unsigned seed = 1;
+
+  while (len + 5 < cap) {
+    seed = seed * 1103515245 + 12345;
+    const unsigned r = (seed >> 16) % 1000;
+    const char *sym = r < 3 ? "\n" : symbols[r % 4];
+    for (size_t i = 0; i < strlen(sym); i++) {
+      lines[len] = line;
+      columns[len] = column + (i > 0);
+      s[len++] = sym[i];
+    }
+    if (sym[0] == '\n') {
+      line++;
+      column = 0;
+    } else {
+      column++;
+    }
+  }
+  lines[len] = line;
+  columns[len] = column;
+
+  struct utf8_line_index idx;
+  ASSERT_TRUE(utf8_line_index_init(&idx, U8(s), len) != NULL);
+  ASSERT_EQ(idx.line_count, line + 1);
+
+  for (size_t i = 0; i <= len; i++) {
+    size_t l, c;
+    ASSERT_TRUE(utf8_line_index_position(&idx, i, &l, &c));
+    ASSERT_EQ(l, lines[i]);
+    ASSERT_EQ(c, columns[i]);
+    // Round trip for offsets at the start of a symbol.
+    if (i == len || (s[i] & 0xC0) != 0x80)
+      ASSERT_EQ(utf8_line_index_offset(&idx, l, c), i);
+  }
+
+  utf8_line_index_free(&idx);
+  free(s);
+  free(lines);
+  free(columns);
+}
+
+UTEST_MAIN()
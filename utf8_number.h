@@ -0,0 +1,38 @@
+#ifndef KL_UTF8_NUMBER_H
+#define KL_UTF8_NUMBER_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Parsers for numbers at the start of slices of UTF-8, like std::from_chars.
+// They do not depend on the locale, skip no whitespace and accept no '+'.
+// Each returns the number of bytes which make up the number, or 0 if s does
+// not start with one. Runs of 8 digits are converted at once.
+
+// Decimal digits. On overflow, sets utf8_lib_error to NUMBER_OUT_OF_RANGE
+// and returns SIZE_MAX.
+size_t utf8_parse_u64(const utf8_chr *const s, size_t len,
+                      uint64_t *const value);
+
+// A '-' and decimal digits. On overflow, sets utf8_lib_error to
+// NUMBER_OUT_OF_RANGE and returns SIZE_MAX.
+size_t utf8_parse_i64(const utf8_chr *const s, size_t len,
+                      int64_t *const value);
+
+// An optional '-', digits with an optional '.', at least one of them, and an
+// optional exponent ("e-7" or "E+21"), or "inf", "infinity" or "nan" in any
+// case. The result is rounded to nearest, ties to even. Values which are too
+// large or too small become inf and 0, as with strtod.
+// Up to 19 digits are converted with the method of Eisel and Lemire; longer
+// numbers fall back to strtod where the digits left out matter.
+size_t utf8_parse_double(const utf8_chr *const s, size_t len,
+                         double *const value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_NUMBER_H
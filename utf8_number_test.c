@@ -0,0 +1,172 @@
+#include "utest/utest.h"
+#include "utf8_number.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_parse_u64, utf8_parse_i64                          //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_parse_u64, valid) {
+  uint64_t v = 7;
+  ASSERT_EQ(utf8_parse_u64("0", 1, &v), 1u);
+  ASSERT_EQ(v, 0u);
+  ASSERT_EQ(utf8_parse_u64("12345678901234,", 15, &v), 14u);
+  ASSERT_EQ(v, 12345678901234u);
+  ASSERT_EQ(utf8_parse_u64("0000000000000042", 16, &v), 16u);
+  ASSERT_EQ(v, 42u);
+  ASSERT_EQ(utf8_parse_u64("18446744073709551615", 20, &v), 20u);
+  ASSERT_EQ(v, UINT64_MAX);
+  // Only the slice is read.
+  ASSERT_EQ(utf8_parse_u64("123456789", 4, &v), 4u);
+  ASSERT_EQ(v, 1234u);
+}
+
+UTEST(utf8_parse_u64, no_number) {
+  uint64_t v = 7;
+  ASSERT_EQ(utf8_parse_u64("", 0, &v), 0u);
+  ASSERT_EQ(utf8_parse_u64("-1", 2, &v), 0u);
+  ASSERT_EQ(utf8_parse_u64("+1", 2, &v), 0u);
+  ASSERT_EQ(utf8_parse_u64(" 1", 2, &v), 0u);
+  ASSERT_EQ(v, 7u);
+}
+
+UTEST(utf8_parse_u64, overflow) {
+  uint64_t v = 7;
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_parse_u64("18446744073709551616", 20, &v), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), NUMBER_OUT_OF_RANGE);
+  ASSERT_EQ(utf8_parse_u64("100000000000000000000", 21, &v), SIZE_MAX);
+  ASSERT_EQ(v, 7u);
+}
+
+UTEST(utf8_parse_i64, valid) {
+  int64_t v = 7;
+  ASSERT_EQ(utf8_parse_i64("-42 ", 4, &v), 3u);
+  ASSERT_EQ(v, -42);
+  ASSERT_EQ(utf8_parse_i64("9223372036854775807", 19, &v), 19u);
+  ASSERT_EQ(v, INT64_MAX);
+  ASSERT_EQ(utf8_parse_i64("-9223372036854775808", 20, &v), 20u);
+  ASSERT_EQ(v, INT64_MIN);
+  ASSERT_EQ(utf8_parse_i64("-", 1, &v), 0u);
+  ASSERT_EQ(utf8_parse_i64("--1", 3, &v), 0u);
+
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_parse_i64("9223372036854775808", 19, &v), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), NUMBER_OUT_OF_RANGE);
+  ASSERT_EQ(utf8_parse_i64("-9223372036854775809", 20, &v), SIZE_MAX);
+}
+
+UTEST(utf8_parse_i64, random) {
+  char buffer[32];
+  uint64_t x = 88172645463325252ULL;
+  for (int i = 0; i < 10000; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    const int64_t expected = (int64_t)x >> (x % 64);
+    const int n = snprintf(buffer, sizeof(buffer), "%lld", (long long)expected);
+    int64_t v;
+    ASSERT_EQ(utf8_parse_i64(buffer, n, &v), (size_t)n);
+    ASSERT_EQ(v, expected);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_parse_double                                       //
+//////////////////////////////////////////////////////////////////////
+
+// Whether utf8_parse_double gives the same bits and length as strtod.
+static int same_as_strtod(const char *const s) {
+  double a = 0;
+  char *end;
+  const double b = strtod(s, &end);
+  const size_t n = utf8_parse_double(s, strlen(s), &a);
+  return n == (size_t)(end - s) && memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+UTEST(utf8_parse_double, valid) {
+  double v = 7;
+  ASSERT_EQ(utf8_parse_double("0.1", 3, &v), 3u);
+  ASSERT_EQ(v, 0.1);
+  ASSERT_EQ(utf8_parse_double("-1.5e-7,", 8, &v), 7u);
+  ASSERT_EQ(v, -1.5e-7);
+  ASSERT_EQ(utf8_parse_double("1E+21", 5, &v), 5u);
+  ASSERT_EQ(v, 1e21);
+  ASSERT_EQ(utf8_parse_double(".5", 2, &v), 2u);
+  ASSERT_EQ(v, 0.5);
+  ASSERT_EQ(utf8_parse_double("5.", 2, &v), 2u);
+  ASSERT_EQ(v, 5.0);
+  // An exponent without digits is not part of the number.
+  ASSERT_EQ(utf8_parse_double("2e", 2, &v), 1u);
+  ASSERT_EQ(utf8_parse_double("2e-x", 4, &v), 1u);
+  ASSERT_EQ(v, 2.0);
+  // Only the slice is read.
+  ASSERT_EQ(utf8_parse_double("3.25e2", 4, &v), 4u);
+  ASSERT_EQ(v, 3.25);
+}
+
+UTEST(utf8_parse_double, no_number) {
+  double v = 7;
+  ASSERT_EQ(utf8_parse_double("", 0, &v), 0u);
+  ASSERT_EQ(utf8_parse_double("-", 1, &v), 0u);
+  ASSERT_EQ(utf8_parse_double(".", 1, &v), 0u);
+  ASSERT_EQ(utf8_parse_double("+1", 2, &v), 0u);
+  ASSERT_EQ(utf8_parse_double("e5", 2, &v), 0u);
+  ASSERT_EQ(utf8_parse_double("info", 4, &v), 3u);
+  ASSERT_EQ(utf8_parse_double("nope", 4, &v), 0u);
+}
+
+UTEST(utf8_parse_double, special) {
+  double v = 0;
+  ASSERT_EQ(utf8_parse_double("-0", 2, &v), 2u);
+  ASSERT_TRUE(v == 0 && signbit(v));
+  ASSERT_EQ(utf8_parse_double("Infinity", 8, &v), 8u);
+  ASSERT_TRUE(isinf(v) && v > 0);
+  ASSERT_EQ(utf8_parse_double("-inf", 4, &v), 4u);
+  ASSERT_TRUE(isinf(v) && v < 0);
+  ASSERT_EQ(utf8_parse_double("NaN", 3, &v), 3u);
+  ASSERT_TRUE(isnan(v));
+  ASSERT_EQ(utf8_parse_double("1e400", 5, &v), 5u);
+  ASSERT_TRUE(isinf(v));
+  ASSERT_EQ(utf8_parse_double("1e-400", 6, &v), 6u);
+  ASSERT_EQ(v, 0.0);
+}
+
+UTEST(utf8_parse_double, hard_cases) {
+  ASSERT_TRUE(same_as_strtod("2.2250738585072014e-308"));
+  ASSERT_TRUE(same_as_strtod("4.9e-324"));
+  ASSERT_TRUE(same_as_strtod("2.4703282292062327e-324"));
+  ASSERT_TRUE(same_as_strtod("2.4703282292062328e-324"));
+  ASSERT_TRUE(same_as_strtod("1.7976931348623158e308"));
+  ASSERT_TRUE(same_as_strtod("9007199254740993"));
+  ASSERT_TRUE(same_as_strtod("0.000000000000000000000000000000000000001e39"));
+  // Exactly halfway between 1 and the next double, and just beside it.
+  ASSERT_TRUE(same_as_strtod("1.00000000000000011102230246251565404236316680"
+                             "908203125"));
+  ASSERT_TRUE(same_as_strtod("1.00000000000000011102230246251565404236316680"
+                             "908203124"));
+  ASSERT_TRUE(same_as_strtod("1.00000000000000011102230246251565404236316680"
+                             "9082031250000000000000000000000000000001"));
+}
+
+UTEST(utf8_parse_double, random) {
+  char buffer[64];
+  uint64_t x = 88172645463325252ULL;
+  for (int i = 0; i < 100000; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    double d;
+    memcpy(&d, &x, sizeof(d));
+    if (isnan(d) || isinf(d))
+      continue;
+    snprintf(buffer, sizeof(buffer), "%.*e", (int)(x % 24), d);
+    ASSERT_TRUE(same_as_strtod(buffer));
+  }
+}
+
+UTEST_MAIN()
@@ -0,0 +1,986 @@
+#include "utf8_pattern.h"
+#include "kl_hash.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Limits which keep compilation time and memory bounded.
+#define MAX_DEPTH 256
+#define MAX_REPEAT 1000
+#define MAX_NFA_STATES 100000
+#define MAX_DFA_STATES 4096
+
+#define INFINITE UINT32_MAX
+
+struct utf8_pattern {
+  uint32_t classes;
+  // Entries of next are (offset << 1) | accepting, where offset is the index
+  // of the first transition of a state. The dead state has offset 0 and
+  // never accepts, so its entry is 0.
+  uint32_t anchored_start;
+  uint32_t search_start;
+  uint8_t byte_class[256];
+  uint32_t *next;
+};
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Syntax tree                                             //
+//////////////////////////////////////////////////////////////////////
+
+struct range {
+  utf8_code_pt lo;
+  utf8_code_pt hi;
+};
+
+enum node_type { NODE_EMPTY, NODE_CLASS, NODE_CAT, NODE_ALT, NODE_REPEAT };
+
+struct node {
+  enum node_type type;
+  // Children of NODE_CAT, NODE_ALT and NODE_REPEAT (a only).
+  int a;
+  int b;
+  uint32_t min;
+  uint32_t max;
+  // Ranges of NODE_CLASS.
+  size_t first;
+  size_t count;
+};
+
+enum nfa_kind { NFA_BYTE, NFA_SPLIT, NFA_EPS, NFA_MATCH };
+
+struct nfa_state {
+  uint8_t kind;
+  uint8_t lo;
+  uint8_t hi;
+  int out;
+  int out1;
+};
+
+struct compiler {
+  const utf8_chr *pat;
+  size_t len;
+  size_t pos;
+  int depth;
+  bool error;
+
+  struct node *nodes;
+  size_t nodes_len;
+  size_t nodes_cap;
+  struct range *ranges;
+  size_t ranges_len;
+  size_t ranges_cap;
+  struct nfa_state *nfa;
+  size_t nfa_len;
+  size_t nfa_cap;
+};
+
+// Make room for one more element. Returns false if memory could not be
+// allocated.
+static bool reserve(void **arr, size_t *cap, size_t len, size_t size) {
+  if (len < *cap)
+    return true;
+  const size_t new_cap = *cap ? *cap * 2 : 64;
+  void *temp = realloc(*arr, new_cap * size);
+  if (!temp)
+    return false;
+  *arr = temp;
+  *cap = new_cap;
+  return true;
+}
+
+static void syntax_error(struct compiler *c) {
+  if (!c->error)
+    set_utf8_lib_error(INVALID_PATTERN);
+  c->error = true;
+}
+
+static int new_node(struct compiler *c, enum node_type type, int a, int b) {
+  if (!reserve((void **)&c->nodes, &c->nodes_cap, c->nodes_len,
+               sizeof(struct node))) {
+    c->error = true;
+    return -1;
+  }
+  struct node *n = &c->nodes[c->nodes_len];
+  n->type = type;
+  n->a = a;
+  n->b = b;
+  n->min = n->max = 0;
+  n->first = n->count = 0;
+  return (int)c->nodes_len++;
+}
+
+static bool push_range(struct compiler *c, utf8_code_pt lo, utf8_code_pt hi) {
+  if (!reserve((void **)&c->ranges, &c->ranges_cap, c->ranges_len,
+               sizeof(struct range))) {
+    c->error = true;
+    return false;
+  }
+  c->ranges[c->ranges_len].lo = lo;
+  c->ranges[c->ranges_len].hi = hi;
+  c->ranges_len++;
+  return true;
+}
+
+static int range_cmp(const void *x, const void *y) {
+  const utf8_code_pt a = ((const struct range *)x)->lo;
+  const utf8_code_pt b = ((const struct range *)y)->lo;
+  return a < b ? -1 : a > b;
+}
+
+// Turn the ranges from first to the end into a class node. The ranges are
+// sorted, merged and complemented if negate is set.
+static int finish_class(struct compiler *c, size_t first, bool negate) {
+  struct range *r = c->ranges + first;
+  size_t n = c->ranges_len - first;
+  qsort(r, n, sizeof(struct range), range_cmp);
+
+  size_t merged = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (merged > 0 && r[i].lo <= r[merged - 1].hi + 1) {
+      if (r[i].hi > r[merged - 1].hi)
+        r[merged - 1].hi = r[i].hi;
+    } else {
+      r[merged++] = r[i];
+    }
+  }
+  c->ranges_len = first + merged;
+
+  if (negate) {
+    // The complement has at most one range more. Build it behind the
+    // merged ranges and move it to the front.
+    const size_t start = c->ranges_len;
+    utf8_code_pt lo = 0;
+    for (size_t i = 0; i < merged; i++) {
+      const struct range cur = c->ranges[first + i];
+      if (cur.lo > lo && !push_range(c, lo, cur.lo - 1))
+        return -1;
+      lo = cur.hi + 1;
+    }
+    if (lo <= UNICODE_MAX_CODEPT && !push_range(c, lo, UNICODE_MAX_CODEPT))
+      return -1;
+    const size_t len = c->ranges_len - start;
+    memmove(c->ranges + first, c->ranges + start, len * sizeof(struct range));
+    c->ranges_len = first + len;
+  }
+
+  const int node = new_node(c, NODE_CLASS, -1, -1);
+  if (node < 0)
+    return -1;
+  c->nodes[node].first = first;
+  c->nodes[node].count = c->ranges_len - first;
+  return node;
+}
+
+static int single(struct compiler *c, utf8_code_pt lo, utf8_code_pt hi) {
+  const size_t first = c->ranges_len;
+  if (!push_range(c, lo, hi))
+    return -1;
+  return finish_class(c, first, false);
+}
+
+static bool at_end(const struct compiler *c) { return c->pos >= c->len; }
+
+static utf8_code_pt peek(const struct compiler *c) {
+  return (uint8_t)c->pat[c->pos];
+}
+
+// Read the next symbol of the pattern.
+static bool next_codepoint(struct compiler *c, utf8_code_pt *cp) {
+  if (at_end(c)) {
+    syntax_error(c);
+    return false;
+  }
+  const int n = utf8_decode_next(c->pat + c->pos, c->len - c->pos, cp);
+  if (n < 1) {
+    if (!c->error)
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+    c->error = true;
+    return false;
+  }
+  c->pos += n;
+  return true;
+}
+
+// Add the ranges of \d, \w or \s. Returns false if e is none of them.
+static bool push_shorthand(struct compiler *c, utf8_code_pt e) {
+  switch (e) {
+  case 'd':
+    return push_range(c, '0', '9');
+  case 'w':
+    return push_range(c, '0', '9') && push_range(c, 'A', 'Z') &&
+           push_range(c, '_', '_') && push_range(c, 'a', 'z');
+  case 's':
+    return push_range(c, '\t', '\r') && push_range(c, ' ', ' ');
+  }
+  return false;
+}
+
+// The symbol of an escape sequence which stands for a single symbol.
+// Letters and digits other than n, r and t are reserved.
+static bool escaped_symbol(struct compiler *c, utf8_code_pt e,
+                           utf8_code_pt *cp) {
+  switch (e) {
+  case 'n':
+    *cp = '\n';
+    return true;
+  case 'r':
+    *cp = '\r';
+    return true;
+  case 't':
+    *cp = '\t';
+    return true;
+  }
+  if ((e >= '0' && e <= '9') || (e >= 'A' && e <= 'Z') ||
+      (e >= 'a' && e <= 'z')) {
+    syntax_error(c);
+    return false;
+  }
+  *cp = e;
+  return true;
+}
+
+// A single symbol in a class, possibly escaped. *shorthand is set if it was
+// \d, \w or \s, whose ranges were added already.
+static bool class_symbol(struct compiler *c, bool regex, utf8_code_pt *cp,
+                         bool *shorthand) {
+  *shorthand = false;
+  if (!next_codepoint(c, cp))
+    return false;
+  if (*cp != '\\')
+    return true;
+  utf8_code_pt e;
+  if (!next_codepoint(c, &e))
+    return false;
+  if (!regex) {
+    *cp = e;
+    return true;
+  }
+  if (e == 'd' || e == 'w' || e == 's') {
+    *shorthand = true;
+    return push_shorthand(c, e);
+  }
+  return escaped_symbol(c, e, cp);
+}
+
+// A class after the opening '['.
+static int parse_class(struct compiler *c, bool regex) {
+  const size_t first = c->ranges_len;
+  bool negate = false;
+  if (!at_end(c) && (peek(c) == '^' || (!regex && peek(c) == '!'))) {
+    negate = true;
+    c->pos++;
+  }
+
+  bool first_symbol = true;
+  for (;;) {
+    if (at_end(c)) {
+      syntax_error(c);
+      return -1;
+    }
+    if (peek(c) == ']' && !first_symbol) {
+      c->pos++;
+      break;
+    }
+    first_symbol = false;
+
+    utf8_code_pt lo, hi;
+    bool shorthand;
+    if (!class_symbol(c, regex, &lo, &shorthand))
+      return -1;
+    if (shorthand)
+      continue;
+    hi = lo;
+    if (c->pos + 1 < c->len && peek(c) == '-' &&
+        (uint8_t)c->pat[c->pos + 1] != ']') {
+      c->pos++;
+      if (!class_symbol(c, regex, &hi, &shorthand))
+        return -1;
+      if (shorthand || hi < lo) {
+        syntax_error(c);
+        return -1;
+      }
+    }
+    if (!push_range(c, lo, hi))
+      return -1;
+  }
+  return finish_class(c, first, negate);
+}
+
+static int repeat(struct compiler *c, int node, uint32_t min, uint32_t max) {
+  const int n = new_node(c, NODE_REPEAT, node, -1);
+  if (n < 0)
+    return -1;
+  c->nodes[n].min = min;
+  c->nodes[n].max = max;
+  return n;
+}
+
+static int any_symbol(struct compiler *c) {
+  return single(c, 0, UNICODE_MAX_CODEPT);
+}
+
+static int parse_glob(struct compiler *c) {
+  int res = new_node(c, NODE_EMPTY, -1, -1);
+  while (res >= 0 && !at_end(c)) {
+    int n;
+    utf8_code_pt cp;
+    switch (peek(c)) {
+    case '*':
+      c->pos++;
+      n = any_symbol(c);
+      if (n >= 0)
+        n = repeat(c, n, 0, INFINITE);
+      break;
+    case '?':
+      c->pos++;
+      n = any_symbol(c);
+      break;
+    case '[':
+      c->pos++;
+      n = parse_class(c, false);
+      break;
+    case '\\':
+      c->pos++;
+      n = next_codepoint(c, &cp) ? single(c, cp, cp) : -1;
+      break;
+    default:
+      n = next_codepoint(c, &cp) ? single(c, cp, cp) : -1;
+      break;
+    }
+    res = n < 0 ? -1 : new_node(c, NODE_CAT, res, n);
+  }
+  return res;
+}
+
+static int parse_alt(struct compiler *c);
+
+static int parse_atom(struct compiler *c) {
+  utf8_code_pt cp;
+  switch (peek(c)) {
+  case '(': {
+    c->pos++;
+    const int n = parse_alt(c);
+    if (n < 0)
+      return -1;
+    if (at_end(c) || peek(c) != ')') {
+      syntax_error(c);
+      return -1;
+    }
+    c->pos++;
+    return n;
+  }
+  case '[':
+    c->pos++;
+    return parse_class(c, true);
+  case '.':
+    c->pos++;
+    return any_symbol(c);
+  case '\\': {
+    c->pos++;
+    utf8_code_pt e;
+    if (!next_codepoint(c, &e))
+      return -1;
+    const size_t first = c->ranges_len;
+    if (e == 'd' || e == 'w' || e == 's' || e == 'D' || e == 'W' ||
+        e == 'S') {
+      const bool negate = e < 'a';
+      if (!push_shorthand(c, negate ? e + ('a' - 'A') : e))
+        return -1;
+      return finish_class(c, first, negate);
+    }
+    if (!escaped_symbol(c, e, &cp))
+      return -1;
+    return single(c, cp, cp);
+  }
+  case ')':
+  case '*':
+  case '+':
+  case '?':
+  case '{':
+  case '|':
+    syntax_error(c);
+    return -1;
+  }
+  if (!next_codepoint(c, &cp))
+    return -1;
+  return single(c, cp, cp);
+}
+
+static bool parse_number(struct compiler *c, uint32_t *n) {
+  if (at_end(c) || peek(c) < '0' || peek(c) > '9')
+    return false;
+  *n = 0;
+  while (!at_end(c) && peek(c) >= '0' && peek(c) <= '9') {
+    *n = *n * 10 + (peek(c) - '0');
+    if (*n > MAX_REPEAT)
+      return false;
+    c->pos++;
+  }
+  return true;
+}
+
+static int parse_repeat(struct compiler *c) {
+  const int n = parse_atom(c);
+  if (n < 0 || at_end(c))
+    return n;
+  uint32_t min, max;
+  switch (peek(c)) {
+  case '*':
+    min = 0, max = INFINITE;
+    break;
+  case '+':
+    min = 1, max = INFINITE;
+    break;
+  case '?':
+    min = 0, max = 1;
+    break;
+  case '{':
+    c->pos++;
+    if (!parse_number(c, &min)) {
+      syntax_error(c);
+      return -1;
+    }
+    max = min;
+    if (!at_end(c) && peek(c) == ',') {
+      c->pos++;
+      max = INFINITE;
+      if (!at_end(c) && peek(c) != '}' && !parse_number(c, &max)) {
+        syntax_error(c);
+        return -1;
+      }
+    }
+    if (at_end(c) || peek(c) != '}' || max < min) {
+      syntax_error(c);
+      return -1;
+    }
+    break;
+  default:
+    return n;
+  }
+  c->pos++;
+  // A lazy quantifier matches the same texts as a greedy one.
+  if (!at_end(c) && peek(c) == '?')
+    c->pos++;
+  if (!at_end(c) && (peek(c) == '*' || peek(c) == '+' || peek(c) == '?' ||
+                     peek(c) == '{')) {
+    syntax_error(c);
+    return -1;
+  }
+  return repeat(c, n, min, max);
+}
+
+static int parse_cat(struct compiler *c) {
+  int res = new_node(c, NODE_EMPTY, -1, -1);
+  while (res >= 0 && !at_end(c) && peek(c) != '|' && peek(c) != ')') {
+    const int n = parse_repeat(c);
+    res = n < 0 ? -1 : new_node(c, NODE_CAT, res, n);
+  }
+  return res;
+}
+
+static int parse_alt(struct compiler *c) {
+  if (++c->depth > MAX_DEPTH) {
+    syntax_error(c);
+    return -1;
+  }
+  int res = parse_cat(c);
+  while (res >= 0 && !at_end(c) && peek(c) == '|') {
+    c->pos++;
+    const int n = parse_cat(c);
+    res = n < 0 ? -1 : new_node(c, NODE_ALT, res, n);
+  }
+  c->depth--;
+  return res;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: NFA                                                     //
+//////////////////////////////////////////////////////////////////////
+
+// A piece of the NFA. end is an NFA_EPS state whose out is not set yet.
+struct frag {
+  int start;
+  int end;
+};
+
+static int new_state(struct compiler *c, enum nfa_kind kind, uint8_t lo,
+                     uint8_t hi, int out, int out1) {
+  if (c->nfa_len >= MAX_NFA_STATES) {
+    syntax_error(c);
+    return -1;
+  }
+  if (!reserve((void **)&c->nfa, &c->nfa_cap, c->nfa_len,
+               sizeof(struct nfa_state))) {
+    c->error = true;
+    return -1;
+  }
+  struct nfa_state *s = &c->nfa[c->nfa_len];
+  s->kind = kind;
+  s->lo = lo;
+  s->hi = hi;
+  s->out = out;
+  s->out1 = out1;
+  return (int)c->nfa_len++;
+}
+
+// Add the UTF-8 encodings of the codepoints lo to hi as alternatives which
+// lead to end. All encodings of a range of codepoints with the same length
+// and the same leading bits form a sequence of byte ranges, so the range is
+// split until that is the case.
+static bool lower_range(struct compiler *c, utf8_code_pt lo, utf8_code_pt hi,
+                        int *start, int end) {
+  // Surrogates have no encoding.
+  if (lo <= 0xDFFF && hi >= 0xD800) {
+    if (lo < 0xD800 && !lower_range(c, lo, 0xD7FF, start, end))
+      return false;
+    return hi <= 0xDFFF || lower_range(c, 0xE000, hi, start, end);
+  }
+
+  static const utf8_code_pt max_of_length[] = {0x7F, 0x7FF, 0xFFFF};
+  for (int i = 0; i < 3; i++) {
+    const utf8_code_pt m = max_of_length[i];
+    if (lo <= m && hi > m)
+      return lower_range(c, lo, m, start, end) &&
+             lower_range(c, m + 1, hi, start, end);
+  }
+
+  for (int i = 1; i < 4; i++) {
+    const utf8_code_pt m = (1u << (6 * i)) - 1;
+    if ((lo & ~m) != (hi & ~m)) {
+      if ((lo & m) != 0)
+        return lower_range(c, lo, lo | m, start, end) &&
+               lower_range(c, (lo | m) + 1, hi, start, end);
+      if ((hi & m) != m)
+        return lower_range(c, lo, (hi & ~m) - 1, start, end) &&
+               lower_range(c, hi & ~m, hi, start, end);
+    }
+  }
+
+  utf8_chr lo_bytes[4], hi_bytes[4];
+  const int n = utf8_from_codepoint(lo, lo_bytes);
+  utf8_from_codepoint(hi, hi_bytes);
+  int next = end;
+  for (int i = n - 1; i >= 0; i--) {
+    next = new_state(c, NFA_BYTE, (uint8_t)lo_bytes[i], (uint8_t)hi_bytes[i],
+                     next, -1);
+    if (next < 0)
+      return false;
+  }
+  *start = *start < 0 ? next : new_state(c, NFA_SPLIT, 0, 0, next, *start);
+  return *start >= 0;
+}
+
+static bool build(struct compiler *c, int node, struct frag *f);
+
+static bool build_repeat(struct compiler *c, const struct node *n,
+                         struct frag *f) {
+  // a{2,4} becomes a a (a (a)?)?, a{2,} becomes a a a*.
+  const int end = new_state(c, NFA_EPS, 0, 0, -1, -1);
+  if (end < 0)
+    return false;
+  f->start = f->end = end;
+
+  for (uint32_t i = 0; i < n->min; i++) {
+    struct frag a;
+    if (!build(c, n->a, &a))
+      return false;
+    c->nfa[f->end].out = a.start;
+    f->end = a.end;
+  }
+
+  if (n->max == INFINITE) {
+    struct frag a;
+    if (!build(c, n->a, &a))
+      return false;
+    const int loop = new_state(c, NFA_SPLIT, 0, 0, a.start, -1);
+    const int after = new_state(c, NFA_EPS, 0, 0, -1, -1);
+    if (loop < 0 || after < 0)
+      return false;
+    c->nfa[loop].out1 = after;
+    c->nfa[a.end].out = loop;
+    c->nfa[f->end].out = loop;
+    f->end = after;
+    return true;
+  }
+
+  // Every optional copy can skip to the very end.
+  const int after = new_state(c, NFA_EPS, 0, 0, -1, -1);
+  if (after < 0)
+    return false;
+  for (uint32_t i = n->min; i < n->max; i++) {
+    struct frag a;
+    if (!build(c, n->a, &a))
+      return false;
+    const int split = new_state(c, NFA_SPLIT, 0, 0, a.start, after);
+    if (split < 0)
+      return false;
+    c->nfa[f->end].out = split;
+    f->end = a.end;
+  }
+  c->nfa[f->end].out = after;
+  f->end = after;
+  return true;
+}
+
+// Concatenations and alternations of more than two operands are nested on
+// the left, like ((a b) c) d. They are walked in a loop instead of by
+// recursion, so that long patterns do not exhaust the stack.
+static bool build_chain(struct compiler *c, int node, struct frag *f) {
+  const enum node_type type = c->nodes[node].type;
+  size_t len = 0;
+  for (int k = node; c->nodes[k].type == type; k = c->nodes[k].a)
+    len++;
+  int *chain = malloc(len * sizeof(int));
+  if (!chain) {
+    c->error = true;
+    return false;
+  }
+  int first = node;
+  for (size_t i = len; i-- > 0; first = c->nodes[first].a)
+    chain[i] = first;
+
+  bool ok = build(c, first, f);
+  int end = -1;
+  if (ok && type == NODE_ALT) {
+    end = new_state(c, NFA_EPS, 0, 0, -1, -1);
+    ok = end >= 0;
+    if (ok)
+      c->nfa[f->end].out = end;
+  }
+  for (size_t i = 0; ok && i < len; i++) {
+    struct frag b;
+    ok = build(c, c->nodes[chain[i]].b, &b);
+    if (!ok)
+      break;
+    if (type == NODE_CAT) {
+      c->nfa[f->end].out = b.start;
+      f->end = b.end;
+    } else {
+      f->start = new_state(c, NFA_SPLIT, 0, 0, f->start, b.start);
+      ok = f->start >= 0;
+      c->nfa[b.end].out = end;
+    }
+  }
+  if (type == NODE_ALT)
+    f->end = end;
+  free(chain);
+  return ok;
+}
+
+static bool build(struct compiler *c, int node, struct frag *f) {
+  const struct node n = c->nodes[node];
+  switch (n.type) {
+  case NODE_EMPTY:
+    f->start = f->end = new_state(c, NFA_EPS, 0, 0, -1, -1);
+    return f->start >= 0;
+
+  case NODE_CLASS: {
+    f->end = new_state(c, NFA_EPS, 0, 0, -1, -1);
+    if (f->end < 0)
+      return false;
+    int start = -1;
+    for (size_t i = 0; i < n.count; i++) {
+      const struct range r = c->ranges[n.first + i];
+      if (!lower_range(c, r.lo, r.hi, &start, f->end))
+        return false;
+    }
+    // An empty class never matches. A byte state with an empty range is
+    // never left.
+    if (start < 0)
+      start = new_state(c, NFA_BYTE, 1, 0, f->end, -1);
+    f->start = start;
+    return start >= 0;
+  }
+
+  case NODE_CAT:
+  case NODE_ALT:
+    return build_chain(c, node, f);
+
+  case NODE_REPEAT:
+    return build_repeat(c, &c->nodes[node], f);
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: DFA                                                     //
+//////////////////////////////////////////////////////////////////////
+
+// Sets of NFA states are stored as sorted lists of their byte and match
+// states, which are the only ones that matter after the epsilon closure.
+struct dfa_builder {
+  const struct nfa_state *nfa;
+  size_t nfa_len;
+
+  // Scratch space for closures.
+  int *stack;
+  uint32_t *mark;
+  uint32_t generation;
+  int *set;
+  size_t set_len;
+
+  // All sets, one after the other.
+  int *sets;
+  size_t sets_len;
+  size_t sets_cap;
+  size_t *set_start;
+  size_t *set_size;
+  size_t count;
+
+  // Open addressing table of set indices + 1.
+  uint32_t *table;
+  size_t table_mask;
+};
+
+static void closure_add(struct dfa_builder *d, int s) {
+  size_t top = 0;
+  d->stack[top++] = s;
+  while (top > 0) {
+    s = d->stack[--top];
+    if (s < 0 || d->mark[s] == d->generation)
+      continue;
+    d->mark[s] = d->generation;
+    switch (d->nfa[s].kind) {
+    case NFA_BYTE:
+    case NFA_MATCH:
+      d->set[d->set_len++] = s;
+      break;
+    case NFA_SPLIT:
+      d->stack[top++] = d->nfa[s].out1;
+      d->stack[top++] = d->nfa[s].out;
+      break;
+    case NFA_EPS:
+      d->stack[top++] = d->nfa[s].out;
+      break;
+    }
+  }
+}
+
+static int int_cmp(const void *x, const void *y) {
+  const int a = *(const int *)x;
+  const int b = *(const int *)y;
+  return a < b ? -1 : a > b;
+}
+
+static uint64_t set_hash(const int *set, size_t len) {
+  return kl_hash(set, len * sizeof(int), 0);
+}
+
+// Index of the set in d->set, which is added if it is new.
+// Returns -1 if there are too many sets or memory could not be allocated.
+static long intern_set(struct dfa_builder *d) {
+  qsort(d->set, d->set_len, sizeof(int), int_cmp);
+  const size_t bytes = d->set_len * sizeof(int);
+  size_t i = set_hash(d->set, d->set_len) & d->table_mask;
+  for (; d->table[i] != 0; i = (i + 1) & d->table_mask) {
+    const size_t k = d->table[i] - 1;
+    if (d->set_size[k] == d->set_len &&
+        memcmp(d->sets + d->set_start[k], d->set, bytes) == 0)
+      return (long)k;
+  }
+
+  if (d->count == MAX_DFA_STATES)
+    return -1;
+  while (d->sets_len + d->set_len > d->sets_cap) {
+    int *temp = realloc(d->sets, d->sets_cap * 2 * sizeof(int));
+    if (!temp)
+      return -1;
+    d->sets = temp;
+    d->sets_cap *= 2;
+  }
+  memcpy(d->sets + d->sets_len, d->set, bytes);
+  d->set_start[d->count] = d->sets_len;
+  d->set_size[d->count] = d->set_len;
+  d->sets_len += d->set_len;
+  d->table[i] = (uint32_t)d->count + 1;
+  return (long)d->count++;
+}
+
+static bool set_accepts(const struct dfa_builder *d, size_t k) {
+  // The match state is the last NFA state and sorts last.
+  const size_t size = d->set_size[k];
+  return size > 0 &&
+         d->nfa[d->sets[d->set_start[k] + size - 1]].kind == NFA_MATCH;
+}
+
+// Subset construction. States are numbered in the order they are found;
+// state 0 is the empty set, that is the dead state.
+static struct utf8_pattern *build_dfa(struct compiler *c, int anchored,
+                                      int search) {
+  struct utf8_pattern *p = malloc(sizeof(struct utf8_pattern));
+  struct dfa_builder d = {0};
+  uint8_t representative[256];
+  bool ok = false;
+
+  d.nfa = c->nfa;
+  d.nfa_len = c->nfa_len;
+  d.stack = malloc((2 * d.nfa_len + 1) * sizeof(int));
+  d.mark = calloc(d.nfa_len, sizeof(uint32_t));
+  d.set = malloc(d.nfa_len * sizeof(int));
+  d.sets_cap = 1024;
+  d.sets = malloc(d.sets_cap * sizeof(int));
+  d.set_start = malloc(MAX_DFA_STATES * sizeof(size_t));
+  d.set_size = malloc(MAX_DFA_STATES * sizeof(size_t));
+  d.table_mask = 2 * MAX_DFA_STATES - 1;
+  d.table = calloc(d.table_mask + 1, sizeof(uint32_t));
+  if (!p || !d.stack || !d.mark || !d.set || !d.sets || !d.set_start ||
+      !d.set_size || !d.table)
+    goto done;
+  p->next = NULL;
+
+  // Bytes which no byte range tells apart share a class.
+  bool boundary[257] = {false};
+  for (size_t i = 0; i < d.nfa_len; i++) {
+    if (d.nfa[i].kind == NFA_BYTE && d.nfa[i].lo <= d.nfa[i].hi) {
+      boundary[d.nfa[i].lo] = true;
+      boundary[d.nfa[i].hi + 1] = true;
+    }
+  }
+  p->classes = 0;
+  for (int b = 0; b < 256; b++) {
+    if (b > 0 && boundary[b])
+      p->classes++;
+    if (b == 0 || boundary[b])
+      representative[p->classes] = (uint8_t)b;
+    p->byte_class[b] = (uint8_t)p->classes;
+  }
+  p->classes++;
+
+  d.set_len = 0;
+  intern_set(&d);
+  d.generation++;
+  d.set_len = 0;
+  closure_add(&d, anchored);
+  const long anchored_k = intern_set(&d);
+  d.generation++;
+  d.set_len = 0;
+  closure_add(&d, search);
+  const long search_k = intern_set(&d);
+  if (anchored_k < 0 || search_k < 0)
+    goto too_large;
+
+  size_t next_cap = 0;
+  for (size_t k = 0; k < d.count; k++) {
+    if ((k + 1) * p->classes > next_cap) {
+      next_cap = next_cap ? next_cap * 2 : 64 * p->classes;
+      uint32_t *temp = realloc(p->next, next_cap * sizeof(uint32_t));
+      if (!temp)
+        goto done;
+      p->next = temp;
+    }
+    for (uint32_t cls = 0; cls < p->classes; cls++) {
+      const uint8_t b = representative[cls];
+      d.generation++;
+      d.set_len = 0;
+      for (size_t j = 0; j < d.set_size[k]; j++) {
+        const struct nfa_state *s = &d.nfa[d.sets[d.set_start[k] + j]];
+        if (s->kind == NFA_BYTE && s->lo <= b && b <= s->hi)
+          closure_add(&d, s->out);
+      }
+      const long target = intern_set(&d);
+      if (target < 0)
+        goto too_large;
+      // Offsets are filled in below, once all states are known.
+      p->next[k * p->classes + cls] = (uint32_t)target;
+    }
+  }
+
+  for (size_t i = 0; i < d.count * p->classes; i++) {
+    const uint32_t k = p->next[i];
+    p->next[i] = (uint32_t)(k * p->classes << 1) | set_accepts(&d, k);
+  }
+  p->anchored_start =
+      (uint32_t)(anchored_k * p->classes << 1) | set_accepts(&d, anchored_k);
+  p->search_start =
+      (uint32_t)(search_k * p->classes << 1) | set_accepts(&d, search_k);
+  ok = true;
+  goto done;
+
+too_large:
+  syntax_error(c);
+done:
+  free(d.stack);
+  free(d.mark);
+  free(d.set);
+  free(d.sets);
+  free(d.set_start);
+  free(d.set_size);
+  free(d.table);
+  if (!ok && p) {
+    free(p->next);
+    free(p);
+    p = NULL;
+  }
+  return p;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: Interface                                               //
+//////////////////////////////////////////////////////////////////////
+
+struct utf8_pattern *utf8_pattern_compile(const utf8_chr *const pattern,
+                                          size_t len,
+                                          enum utf8_pattern_syntax syntax) {
+  struct compiler c = {0};
+  struct utf8_pattern *p = NULL;
+  c.pat = pattern;
+  c.len = len;
+
+  const int root =
+      syntax == UTF8_PATTERN_GLOB ? parse_glob(&c) : parse_alt(&c);
+  if (root < 0)
+    goto done;
+  if (!at_end(&c)) {
+    // A ')' without '('.
+    syntax_error(&c);
+    goto done;
+  }
+
+  struct frag f;
+  if (!build(&c, root, &f))
+    goto done;
+  // The match state comes last, see set_accepts.
+  const int any = new_state(&c, NFA_BYTE, 0, 255, -1, -1);
+  const int search = new_state(&c, NFA_SPLIT, 0, 0, f.start, any);
+  const int match = new_state(&c, NFA_MATCH, 0, 0, -1, -1);
+  if (any < 0 || search < 0 || match < 0)
+    goto done;
+  c.nfa[any].out = search;
+  c.nfa[f.end].out = match;
+
+  p = build_dfa(&c, f.start, search);
+
+done:
+  free(c.nodes);
+  free(c.ranges);
+  free(c.nfa);
+  return p;
+}
+
+void utf8_pattern_free(struct utf8_pattern *p) {
+  if (!p)
+    return;
+  free(p->next);
+  free(p);
+}
+
+bool utf8_pattern_match(const struct utf8_pattern *p, const utf8_chr *const s,
+                        size_t len) {
+  const uint8_t *const b = (const uint8_t *)s;
+  uint32_t state = p->anchored_start;
+  for (size_t i = 0; i < len; i++) {
+    state = p->next[(state >> 1) + p->byte_class[b[i]]];
+    if (state == 0)
+      return false;
+  }
+  return state & 1;
+}
+
+bool utf8_pattern_search(const struct utf8_pattern *p,
+                         const utf8_chr *const s, size_t len) {
+  const uint8_t *const b = (const uint8_t *)s;
+  uint32_t state = p->search_start;
+  for (size_t i = 0; i < len && !(state & 1); i++)
+    state = p->next[(state >> 1) + p->byte_class[b[i]]];
+  return state & 1;
+}
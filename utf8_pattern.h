@@ -0,0 +1,70 @@
+#ifndef KL_UTF8_PATTERN_H
+#define KL_UTF8_PATTERN_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Glob patterns and a subset of regular expressions, compiled to a DFA over
+// bytes. Character classes are lowered to ranges of UTF-8 byte sequences, so
+// text is matched byte by byte in a single pass, without decoding and without
+// backtracking.
+//
+// Globs:
+//   *        Any number of symbols.
+//   ?        Any symbol.
+//   [abc]    One of the symbols. Ranges like [a-z] and [α-ω] are allowed.
+//   [!abc]   Any symbol but these. [^abc] is the same.
+//   \x       The symbol x.
+// Regular expressions:
+//   .        Any symbol.
+//   [...]    Classes as above, negated with [^...]. \d, \w and \s are allowed
+//            inside of classes.
+//   \d \w \s ASCII digits, word characters ([0-9A-Za-z_]) and white space.
+//   \D \W \S Any symbol but these.
+//   \n \r \t Newline, carriage return, tab. Other escapes stand for the
+//            escaped symbol.
+//   ab       Concatenation.
+//   a|b      Alternation.
+//   (a)      Grouping.
+//   a* a+ a? Repetition. a{m}, a{m,} and a{m,n} repeat m to n times.
+//            A '?' after any of these (lazy repetition) is accepted and
+//            ignored, as it does not change what matches. Other stacked
+//            repetitions, like a** or a{2}+, are invalid.
+//
+// "Any symbol" is any valid UTF-8 sequence. Invalid bytes in the text never
+// match anything but are otherwise harmless.
+
+enum utf8_pattern_syntax {
+  UTF8_PATTERN_GLOB,
+  UTF8_PATTERN_REGEX,
+};
+
+struct utf8_pattern;
+
+// Compile the first len bytes of a pattern.
+// Returns NULL on error. If the pattern is invalid or its DFA would be too
+// large, utf8_lib_error is set to INVALID_PATTERN (INVALID_UTF8_SYMBOL for
+// invalid UTF-8). Failed memory allocation does not set utf8_lib_error.
+struct utf8_pattern *utf8_pattern_compile(const utf8_chr *const pattern,
+                                          size_t len,
+                                          enum utf8_pattern_syntax syntax);
+
+void utf8_pattern_free(struct utf8_pattern *p);
+
+// Whether the whole text matches the pattern.
+bool utf8_pattern_match(const struct utf8_pattern *p, const utf8_chr *const s,
+                        size_t len);
+
+// Whether any part of the text matches the pattern. Stops at the end of the
+// first match.
+bool utf8_pattern_search(const struct utf8_pattern *p,
+                         const utf8_chr *const s, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_PATTERN_H
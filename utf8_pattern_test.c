@@ -0,0 +1,147 @@
+#include "utest/utest.h"
+#include "utf8_pattern.h"
+
+#define U8(s) utf8_reinterpret_string(s)
+
+static struct utf8_pattern *compile(const char *pattern,
+                                    enum utf8_pattern_syntax syntax) {
+  return utf8_pattern_compile(U8(pattern), strlen(pattern), syntax);
+}
+
+static bool match(const struct utf8_pattern *p, const char *s) {
+  return utf8_pattern_match(p, U8(s), strlen(s));
+}
+
+static bool search(const struct utf8_pattern *p, const char *s) {
+  return utf8_pattern_search(p, U8(s), strlen(s));
+}
+
+UTEST(utf8_pattern, glob) {
+  struct utf8_pattern *p = compile("*.log", UTF8_PATTERN_GLOB);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_TRUE(match(p, "a.log"));
+  ASSERT_TRUE(match(p, ".log"));
+  ASSERT_TRUE(match(p, "\xCE\xBB.log.log"));
+  ASSERT_FALSE(match(p, "a.log.gz"));
+  ASSERT_FALSE(match(p, "a\xFF.log")); // invalid UTF-8
+  utf8_pattern_free(p);
+
+  // "?" is one symbol, not one byte.
+  p = compile("a?c", UTF8_PATTERN_GLOB);
+  ASSERT_TRUE(match(p, "abc"));
+  ASSERT_TRUE(match(p, "a\xE2\x82\xAC" "c"));
+  ASSERT_FALSE(match(p, "ac"));
+  ASSERT_FALSE(match(p, "abbc"));
+  utf8_pattern_free(p);
+
+  // "[α-ω!]*[!0-9]": one of α to ω or !, anything, no digit
+  p = compile("[\xCE\xB1-\xCF\x89!]*[!0-9]", UTF8_PATTERN_GLOB);
+  ASSERT_TRUE(match(p, "\xCE\xBB\xCE\xBC!x"));
+  ASSERT_TRUE(match(p, "\xCF\x89x"));
+  ASSERT_FALSE(match(p, "\xCE\xBB" "5"));
+  ASSERT_FALSE(match(p, "A5"));
+  utf8_pattern_free(p);
+
+  p = compile("\\*[]a]\\?", UTF8_PATTERN_GLOB);
+  ASSERT_TRUE(match(p, "*]?"));
+  ASSERT_TRUE(match(p, "*a?"));
+  ASSERT_FALSE(match(p, "x]?"));
+  utf8_pattern_free(p);
+}
+
+UTEST(utf8_pattern, regex) {
+  struct utf8_pattern *p = compile("(ab|c)+d?", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_TRUE(match(p, "ab"));
+  ASSERT_TRUE(match(p, "cabcd"));
+  ASSERT_FALSE(match(p, ""));
+  ASSERT_FALSE(match(p, "abd d"));
+  ASSERT_FALSE(match(p, "a"));
+  utf8_pattern_free(p);
+
+  p = compile("\\d{2,3}-\\w+\\s*", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(match(p, "12-ab_9"));
+  ASSERT_TRUE(match(p, "123-x \t"));
+  ASSERT_FALSE(match(p, "1-x"));
+  ASSERT_FALSE(match(p, "1234-x"));
+  ASSERT_FALSE(match(p, "12-"));
+  utf8_pattern_free(p);
+
+  // "[^λ].{2}" on symbols of all lengths
+  p = compile("[^\xCE\xBB].{2}", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(match(p, "a\xF0\x9F\x98\x80\xE2\x82\xAC"));
+  ASSERT_TRUE(match(p, "\xCE\xBC" "ab"));
+  ASSERT_FALSE(match(p, "\xCE\xBB" "ab"));
+  ASSERT_FALSE(match(p, "abcd"));
+  ASSERT_FALSE(match(p, "ab\xED\xA0\x80")); // encoded surrogate
+  utf8_pattern_free(p);
+
+  p = compile("a{0}b{1,}\\.|[\\d\\-x]{3}", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(match(p, "bbb."));
+  ASSERT_TRUE(match(p, "1-x"));
+  ASSERT_FALSE(match(p, "ab."));
+  ASSERT_FALSE(match(p, "12y"));
+  utf8_pattern_free(p);
+
+  // Lazy repetition matches like greedy repetition.
+  p = compile("a+?b{1,2}?c??", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_TRUE(match(p, "aab"));
+  ASSERT_TRUE(match(p, "abbc"));
+  ASSERT_FALSE(match(p, "b"));
+  ASSERT_FALSE(match(p, "abbb"));
+  ASSERT_FALSE(match(p, "abcc"));
+  utf8_pattern_free(p);
+
+  p = compile("", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(match(p, ""));
+  ASSERT_FALSE(match(p, "a"));
+  utf8_pattern_free(p);
+}
+
+UTEST(utf8_pattern, search) {
+  struct utf8_pattern *p = compile("err(or)?: [0-9]+", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_TRUE(search(p, "2024 \xE2\x80\xA6 error: 42 in line"));
+  ASSERT_TRUE(search(p, "err: 1"));
+  ASSERT_FALSE(search(p, "error: x"));
+  ASSERT_FALSE(search(p, ""));
+  utf8_pattern_free(p);
+
+  p = compile("\xCE\xBB", UTF8_PATTERN_REGEX);
+  ASSERT_TRUE(search(p, "x\xCE\xBB"));
+  ASSERT_FALSE(search(p, "x\xCE\xBC\xCE"));
+  utf8_pattern_free(p);
+}
+
+UTEST(utf8_pattern, errors) {
+  const char *invalid[] = {"(a", "a)", "*a", "a{2,1}", "[a", "[b-a]", "a|*",
+                           "\\q", "a{1001}", "\\", "a**", "a+?+",
+                           "a{2}{3}", "a?*"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    set_utf8_lib_error(0);
+    ASSERT_TRUE(compile(invalid[i], UTF8_PATTERN_REGEX) == NULL);
+    ASSERT_EQ(get_utf8_lib_error(), INVALID_PATTERN);
+  }
+
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(compile("a\xFF", UTF8_PATTERN_REGEX) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(compile("a\xF5\x80\x80\x80", UTF8_PATTERN_REGEX) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(compile("[a-\xF5\x80\x80\x80]", UTF8_PATTERN_REGEX) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+
+  // Too many DFA states.
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(compile(".*a.{20}", UTF8_PATTERN_REGEX) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_PATTERN);
+
+  set_utf8_lib_error(0);
+  ASSERT_TRUE(compile("[a", UTF8_PATTERN_GLOB) == NULL);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_PATTERN);
+}
+
+UTEST_MAIN()
@@ -0,0 +1,723 @@
+#include "utf8_props.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define A (UTF8_PROP_ALPHA | UTF8_PROP_XID_START | UTF8_PROP_XID_CONTINUE)
+#define D (UTF8_PROP_DIGIT | UTF8_PROP_XID_CONTINUE)
+#define S UTF8_PROP_SPACE
+#define U UTF8_PROP_XID_CONTINUE
+const uint8_t utf8_ascii_props[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, S, S, S, S, S, 0, 0, // 0x00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x10
+    S, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x20
+    D, D, D, D, D, D, D, D, D, D, 0, 0, 0, 0, 0, 0, // 0x30
+    0, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, // 0x40
+    A, A, A, A, A, A, A, A, A, A, A, 0, 0, 0, 0, U, // 0x50
+    0, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, // 0x60
+    A, A, A, A, A, A, A, A, A, A, A, 0, 0, 0, 0, 0, // 0x70
+};
+#undef A
+#undef D
+#undef S
+#undef U
+
+// Properties of all codepoints as a three-stage table.
+// Generated from the Unicode 14.0 character database.
+static const uint8_t props_stage1[4352] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 1, 17, 18, 19, 1,
+    20, 21, 22, 23, 24, 25, 26, 27, 1, 28, 29, 30, 31, 31, 32, 31, 31, 31, 31,
+    31, 31, 31, 33, 34, 35, 31, 36, 37, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 38, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 39, 1, 40, 41, 42, 43, 44, 45, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 46, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 1, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 31, 79, 80, 81, 82,
+    1, 1, 1, 83, 84, 85, 31, 31, 31, 31, 31, 31, 31, 31, 31, 86, 1, 1, 1, 1, 87,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 88, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 89, 90, 31, 31,
+    91, 92, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    93, 1, 1, 1, 1, 94, 95, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 96, 1, 97, 98, 31, 31, 31, 31, 31, 31, 31, 31, 31, 99, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 100, 31, 101, 102,
+    31, 103, 104, 105, 106, 31, 31, 107, 31, 31, 31, 31, 108, 109, 110, 111, 31,
+    31, 31, 31, 112, 113, 114, 31, 31, 31, 31, 115, 31, 31, 116, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 117, 31, 31, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 118, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 119, 120,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 121, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    122, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 123, 31, 31, 31,
+    31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 124, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 125, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31
+};
+
+static const uint16_t props_stage2[4032] = {
+    0, 1, 0, 0, 2, 0, 3, 4, 5, 6, 6, 7, 5, 6, 6, 8, 9, 0, 0, 0, 2, 10, 11, 10,
+    6, 6, 12, 6, 6, 6, 12, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 6, 14, 0, 15, 16, 0, 0, 17,
+    17, 17, 17, 17, 17, 17, 17, 18, 17, 17, 17, 17, 17, 19, 20, 21, 22, 6, 6,
+    23, 6, 6, 6, 6, 6, 6, 6, 6, 6, 24, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 25, 26, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    5, 6, 6, 6, 12, 27, 6, 6, 6, 6, 6, 28, 29, 17, 17, 17, 30, 31, 32, 0, 6, 6,
+    6, 33, 8, 0, 0, 0, 30, 34, 6, 6, 6, 6, 6, 35, 30, 36, 3, 37, 38, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 39, 40, 41, 42, 3, 43, 0, 0, 44, 6, 6, 6, 30, 30, 17,
+    45, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 46, 30, 47, 0, 3, 48, 6, 6, 6, 49, 50, 51,
+    6, 6, 46, 52, 53, 54, 0, 0, 6, 6, 6, 55, 6, 8, 6, 6, 6, 56, 0, 17, 6, 6, 6,
+    6, 6, 57, 58, 30, 59, 60, 30, 30, 61, 6, 6, 6, 6, 6, 6, 62, 30, 63, 64, 6,
+    65, 3, 5, 6, 66, 67, 68, 6, 6, 69, 70, 71, 72, 73, 74, 75, 65, 3, 14, 76,
+    77, 33, 68, 6, 6, 69, 78, 79, 80, 81, 82, 83, 84, 3, 85, 0, 77, 24, 23, 6,
+    6, 69, 86, 71, 31, 87, 28, 0, 65, 3, 0, 88, 77, 67, 68, 6, 6, 69, 86, 71,
+    72, 81, 89, 75, 65, 3, 27, 0, 90, 91, 92, 93, 94, 91, 6, 95, 96, 97, 98, 0,
+    84, 3, 0, 0, 99, 19, 69, 6, 6, 69, 6, 71, 100, 97, 101, 102, 65, 3, 0, 0,
+    66, 19, 69, 6, 6, 69, 103, 71, 100, 97, 101, 104, 65, 3, 105, 0, 61, 19, 69,
+    6, 6, 6, 6, 106, 100, 107, 108, 109, 65, 3, 0, 26, 77, 6, 12, 26, 6, 6, 23,
+    110, 12, 111, 112, 30, 84, 3, 113, 0, 5, 6, 6, 6, 6, 6, 114, 34, 115, 116,
+    3, 4, 0, 0, 0, 0, 93, 117, 6, 6, 118, 6, 114, 119, 120, 121, 3, 122, 0, 0,
+    0, 0, 28, 0, 0, 123, 3, 4, 124, 125, 6, 5, 6, 6, 6, 15, 126, 30, 127, 128,
+    30, 126, 30, 30, 30, 129, 130, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 35, 131,
+    132, 3, 4, 46, 133, 134, 135, 136, 6, 137, 138, 3, 139, 6, 6, 6, 6, 24, 140,
+    6, 6, 6, 6, 6, 117, 6, 6, 6, 6, 6, 6, 6, 6, 6, 92, 12, 92, 6, 6, 6, 6, 6,
+    92, 6, 6, 6, 6, 92, 12, 92, 6, 12, 6, 6, 6, 6, 6, 6, 6, 92, 6, 6, 6, 6, 6,
+    6, 6, 6, 141, 0, 29, 123, 0, 6, 6, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142,
+    142, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 67, 6, 6,
+    143, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 91, 6, 28, 6, 6, 144, 109, 6, 6,
+    145, 0, 6, 6, 146, 0, 6, 19, 147, 0, 6, 6, 6, 6, 6, 6, 148, 30, 30, 149,
+    150, 151, 3, 4, 0, 0, 0, 152, 3, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 28, 6,
+    6, 6, 6, 6, 153, 6, 6, 6, 6, 6, 6, 6, 6, 142, 0, 6, 6, 6, 12, 30, 154, 30,
+    155, 84, 3, 6, 6, 6, 142, 15, 0, 6, 6, 6, 6, 6, 156, 6, 6, 6, 14, 3, 157, 0,
+    0, 0, 0, 6, 6, 158, 154, 6, 6, 6, 6, 6, 6, 128, 159, 36, 30, 160, 161, 3, 4,
+    3, 4, 109, 0, 17, 162, 149, 163, 0, 0, 0, 0, 0, 0, 164, 6, 6, 6, 6, 6, 165,
+    30, 99, 15, 3, 4, 0, 166, 167, 0, 168, 6, 6, 6, 169, 170, 3, 48, 6, 6, 6, 6,
+    171, 30, 172, 0, 6, 6, 6, 6, 173, 30, 131, 0, 3, 174, 3, 48, 6, 6, 6, 142,
+    6, 28, 6, 6, 6, 6, 6, 175, 0, 0, 176, 17, 17, 177, 178, 179, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 17, 17, 17, 17,
+    180, 30, 160, 17, 6, 6, 142, 142, 6, 6, 6, 6, 142, 142, 6, 181, 6, 6, 6,
+    142, 6, 6, 6, 6, 6, 6, 19, 120, 182, 15, 183, 156, 6, 15, 182, 15, 184, 185,
+    0, 0, 0, 186, 0, 187, 188, 0, 189, 190, 0, 0, 27, 109, 0, 0, 6, 15, 0, 0, 0,
+    0, 0, 0, 17, 191, 192, 17, 188, 0, 193, 26, 110, 194, 16, 195, 6, 196, 197,
+    198, 0, 0, 6, 6, 6, 6, 6, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 199, 200, 200, 200, 200, 200, 200, 201, 0, 0, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 15, 202, 203,
+    0, 6, 6, 6, 6, 24, 140, 6, 6, 6, 6, 6, 6, 6, 109, 0, 187, 6, 6, 12, 0, 12,
+    12, 12, 12, 12, 12, 12, 12, 30, 30, 30, 30, 0, 0, 0, 0, 0, 204, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 205, 0, 0,
+    0, 5, 57, 206, 15, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 12, 207, 5, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 117, 197, 6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 12,
+    0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 15, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6,
+    6, 6, 142, 6, 15, 6, 6, 3, 208, 0, 0, 6, 6, 6, 6, 6, 115, 209, 210, 6, 6, 6,
+    46, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 123, 0, 0, 0, 109, 6, 26, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 68, 6, 6, 6, 6, 6, 6, 6, 8, 211, 14, 0, 0, 26, 6, 212,
+    213, 6, 6, 35, 189, 0, 0, 6, 6, 6, 6, 6, 6, 156, 0, 214, 6, 6, 6, 6, 6, 173,
+    30, 215, 0, 3, 4, 17, 17, 216, 217, 3, 48, 6, 6, 46, 218, 6, 6, 158, 30,
+    219, 0, 6, 6, 6, 15, 61, 6, 6, 6, 6, 6, 220, 30, 188, 109, 3, 4, 221, 6, 3,
+    222, 6, 6, 6, 6, 6, 169, 159, 0, 213, 223, 3, 4, 6, 6, 12, 224, 6, 6, 6, 6,
+    6, 6, 134, 225, 226, 0, 0, 227, 6, 35, 228, 0, 56, 56, 56, 0, 12, 12, 6, 6,
+    6, 6, 6, 117, 6, 14, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 35, 229, 3,
+    4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 156, 0, 6, 6,
+    12, 230, 6, 6, 6, 6, 6, 156, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 0, 0, 0, 0, 12, 0, 230, 231, 6, 69,
+    12, 120, 232, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 0, 0, 0, 230, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 233, 234, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 0, 0, 6, 6, 6, 6,
+    6, 6, 6, 6, 26, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 6, 235, 17, 17, 0, 0, 17,
+    17, 236, 0, 0, 237, 0, 0, 0, 0, 238, 239, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 15, 0, 0, 3, 4, 5, 6, 6, 7, 5, 6, 6, 8, 240, 6, 6, 6, 6, 6, 6,
+    46, 6, 6, 6, 12, 26, 26, 26, 241, 0, 0, 0, 0, 6, 103, 6, 6, 12, 6, 6, 242,
+    6, 142, 6, 142, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6,
+    6, 15, 6, 6, 6, 6, 6, 6, 28, 0, 188, 0, 0, 0, 6, 6, 6, 6, 0, 197, 6, 6, 6,
+    8, 6, 6, 6, 6, 46, 34, 6, 6, 6, 142, 6, 6, 6, 6, 156, 6, 206, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 3, 4, 6, 6, 6,
+    6, 156, 6, 6, 6, 6, 156, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 156, 0, 6, 117,
+    6, 117, 242, 6, 23, 6, 23, 244, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6,
+    12, 0, 6, 6, 142, 0, 6, 0, 0, 0, 24, 6, 6, 6, 6, 6, 69, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 142, 69, 6, 6, 6, 6, 24, 245, 6, 6, 142, 0, 6, 6, 12, 0, 6, 6, 6, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 246, 0, 6, 6, 142, 0, 6, 6, 6, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 240, 0, 0, 0, 0, 0, 0, 0, 0, 247, 209, 103,
+    5, 6, 6, 142, 248, 0, 0, 0, 0, 6, 6, 6, 15, 6, 6, 6, 15, 0, 0, 0, 0, 6, 5,
+    6, 6, 249, 0, 0, 0, 6, 6, 6, 6, 6, 6, 142, 0, 6, 6, 142, 0, 6, 6, 8, 0, 6,
+    6, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 28,
+    0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 8, 0, 6, 6, 6, 6, 6, 6, 8, 0, 6, 6, 6,
+    6, 173, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    250, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 15, 109, 0, 6, 6, 251, 17, 188,
+    0, 0, 0, 6, 6, 252, 0, 0, 0, 0, 0, 6, 6, 15, 0, 0, 0, 6, 6, 12, 0, 168, 6,
+    6, 6, 6, 6, 6, 30, 253, 0, 0, 0, 84, 3, 254, 187, 255, 6, 6, 6, 6, 6, 30,
+    256, 257, 0, 6, 6, 6, 28, 3, 4, 168, 6, 6, 6, 158, 30, 258, 3, 259, 0, 6, 6,
+    6, 6, 260, 0, 168, 6, 6, 6, 6, 6, 35, 30, 261, 262, 3, 263, 0, 0, 0, 0, 6,
+    6, 23, 6, 6, 173, 264, 265, 0, 0, 0, 0, 0, 0, 0, 0, 12, 266, 6, 24, 6, 28,
+    6, 6, 6, 6, 6, 158, 30, 256, 3, 4, 267, 67, 68, 6, 6, 69, 86, 268, 72, 81,
+    98, 197, 269, 191, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 128, 30, 270, 8, 3, 271, 14, 0, 0, 0, 6, 6, 6, 6, 6, 6,
+    30, 30, 272, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 6, 6, 6, 6, 158, 273, 131, 188, 0, 0, 223, 0, 0, 0, 0, 6, 6, 6, 6,
+    6, 6, 30, 131, 274, 0, 3, 4, 0, 0, 0, 0, 6, 6, 6, 6, 6, 35, 275, 28, 3, 4,
+    0, 0, 0, 0, 0, 0, 6, 6, 6, 276, 30, 219, 3, 4, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 173, 30, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 3, 4, 0, 109, 12,
+    277, 278, 6, 6, 6, 31, 279, 280, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 6, 26, 6,
+    6, 6, 6, 169, 281, 282, 0, 0, 0, 169, 168, 6, 6, 6, 6, 283, 284, 187, 0,
+    169, 61, 6, 6, 6, 6, 6, 137, 30, 285, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 28,
+    6, 69, 6, 6, 6, 158, 159, 131, 28, 0, 3, 4, 0, 0, 26, 6, 6, 6, 281, 30, 30,
+    126, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 23, 6, 6, 6, 6, 286, 287, 288, 0,
+    3, 4, 24, 69, 6, 6, 6, 289, 290, 28, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 6, 291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 12, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 28, 0, 6, 6, 6, 6, 6, 12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6,
+    6, 6, 6, 6, 6, 6, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 28, 6, 6, 6, 12, 3, 4, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 12, 3, 4, 6, 6, 6, 142, 191, 0, 6, 6, 6, 6, 6, 6, 292, 0, 156, 0,
+    3, 4, 230, 6, 6, 197, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 293, 169, 30, 30, 30, 30, 30, 30,
+    74, 168, 6, 0, 0, 0, 0, 0, 0, 0, 0, 294, 0, 295, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    142, 0, 0, 0, 0, 0, 6, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 278, 6, 6, 6,
+    6, 8, 0, 0, 0, 0, 0, 8, 0, 296, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 156, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8,
+    6, 15, 6, 28, 6, 297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17,
+    17, 298, 17, 17, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 237, 299, 300, 166, 301,
+    167, 0, 0, 0, 302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 19, 6, 6, 6, 6, 6, 6, 6, 6, 19, 304, 305, 6, 211,
+    103, 6, 6, 6, 6, 6, 6, 6, 24, 175, 19, 19, 6, 6, 6, 306, 120, 26, 69, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 6, 6, 6, 69, 6, 6, 117, 6, 6,
+    6, 117, 6, 6, 19, 6, 6, 6, 19, 6, 6, 12, 6, 6, 6, 12, 6, 6, 6, 69, 6, 6, 6,
+    69, 6, 6, 117, 307, 3, 3, 3, 3, 3, 3, 17, 17, 17, 17, 17, 17, 292, 166, 17,
+    17, 17, 17, 17, 191, 243, 0, 189, 0, 0, 166, 29, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 6, 6, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 159, 30, 30, 308, 309, 34, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 15,
+    310, 142, 3, 311, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 312,
+    0, 0, 6, 6, 6, 6, 6, 313, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 278, 6, 12, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 15, 0, 292, 0, 0, 0, 0,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 314, 315, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 6, 6, 6, 316, 5, 117, 317, 193, 318, 316,
+    181, 316, 117, 117, 83, 6, 23, 6, 156, 319, 23, 6, 156, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 200, 200, 200, 201, 200, 200, 200, 201, 200, 200, 200,
+    201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 28, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 142, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 28, 0, 0, 0, 6, 6, 6, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0
+};
+
+static const uint8_t props_stage3[2560] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x10,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x19, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x00, 0x00, 0x01, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x10, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x19, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x19, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x00, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x11,
+    0x11, 0x00, 0x10, 0x10, 0x10, 0x11, 0x19, 0x19, 0x12, 0x12, 0x19, 0x19,
+    0x19, 0x00, 0x00, 0x19, 0x19, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x11, 0x11, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x12, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10, 0x19, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x11, 0x11, 0x11,
+    0x19, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x19, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x19, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x10, 0x19, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x19, 0x10, 0x10, 0x10,
+    0x10, 0x11, 0x11, 0x11, 0x19, 0x19, 0x11, 0x11, 0x00, 0x00, 0x12, 0x12,
+    0x19, 0x11, 0x11, 0x11, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x10, 0x19, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11,
+    0x11, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x19, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x00,
+    0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x11, 0x11, 0x19, 0x19,
+    0x19, 0x11, 0x00, 0x00, 0x19, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x19, 0x11, 0x11,
+    0x11, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11,
+    0x00, 0x00, 0x11, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00,
+    0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00,
+    0x00, 0x19, 0x19, 0x00, 0x19, 0x00, 0x19, 0x19, 0x00, 0x00, 0x00, 0x19,
+    0x19, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00,
+    0x00, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x10,
+    0x10, 0x19, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x10, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x11, 0x19, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x19, 0x00, 0x19, 0x11, 0x11, 0x10, 0x11, 0x11, 0x19, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x00, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x11, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10,
+    0x10, 0x00, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x19, 0x11, 0x11, 0x19, 0x19,
+    0x19, 0x19, 0x11, 0x11, 0x11, 0x19, 0x11, 0x11, 0x11, 0x19, 0x19, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11,
+    0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x11, 0x12, 0x12, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x00, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x00, 0x00, 0x04, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x11, 0x11, 0x10, 0x10, 0x00, 0x00, 0x19, 0x19, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x00, 0x19, 0x19, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10,
+    0x19, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x11, 0x10, 0x10, 0x10, 0x10,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x10, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x11, 0x11, 0x11, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11,
+    0x12, 0x12, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00,
+    0x00, 0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x19, 0x19, 0x19, 0x19, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x10, 0x19, 0x19, 0x10, 0x10, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x00, 0x19, 0x00, 0x19,
+    0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x19, 0x19, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0x00, 0x00, 0x19, 0x19, 0x19, 0x12, 0x12, 0x19, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x19, 0x19, 0x19, 0x10, 0x19,
+    0x19, 0x19, 0x19, 0x11, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00,
+    0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x10,
+    0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x19, 0x19,
+    0x12, 0x12, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x19, 0x11, 0x11, 0x11, 0x19, 0x19,
+    0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x10, 0x19, 0x10, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x19, 0x19, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x11, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x01, 0x19, 0x01, 0x19,
+    0x01, 0x00, 0x01, 0x19, 0x01, 0x19, 0x01, 0x19, 0x01, 0x19, 0x01, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0x19, 0x19,
+    0x19, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x19, 0x19, 0x00, 0x19,
+    0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x00, 0x19, 0x11, 0x11, 0x11,
+    0x00, 0x11, 0x11, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x10, 0x00, 0x19, 0x19, 0x00, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x10,
+    0x19, 0x19, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x10, 0x00, 0x10, 0x19, 0x19, 0x11, 0x11, 0x19, 0x00, 0x00,
+    0x10, 0x10, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x11, 0x10, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x10, 0x10, 0x00, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x11, 0x11, 0x19, 0x19, 0x19, 0x19, 0x10, 0x00, 0x00, 0x19, 0x00,
+    0x10, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+    0x10, 0x00, 0x11, 0x11, 0x12, 0x12, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x10,
+    0x10, 0x19, 0x11, 0x11, 0x19, 0x19, 0x11, 0x11, 0x00, 0x00, 0x10, 0x10,
+    0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 0x19, 0x12, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x19, 0x11, 0x11, 0x10, 0x10, 0x19, 0x19, 0x00, 0x19,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10,
+    0x19, 0x19, 0x19, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x19, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00,
+    0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x10, 0x19, 0x11, 0x19, 0x11, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x19, 0x00, 0x19, 0x11, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x10,
+    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11,
+    0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x19, 0x11, 0x19, 0x19, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x19, 0x19, 0x19, 0x11, 0x11, 0x11, 0x11, 0x00, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x00, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x19, 0x19, 0x00, 0x19, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00,
+    0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x19, 0x19, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+    0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x00, 0x12, 0x12, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x19, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x00, 0x19, 0x19, 0x19, 0x19,
+    0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x11,
+    0x10, 0x10, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00,
+    0x19, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19,
+    0x00, 0x19, 0x19, 0x19
+};
+
+uint8_t utf8_codepoint_props_slow(utf8_code_pt c) {
+  if (c > UNICODE_MAX_CODEPT)
+    return 0;
+  const size_t i2 = ((size_t)props_stage1[c >> 8] << 5) | ((c >> 3) & 0x1F);
+  return props_stage3[((size_t)props_stage2[i2] << 3) | (c & 7)];
+}
+
+#if defined(__SSE2__)
+static utf8_inline __m128i in_range_epi8(__m128i v, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+// Classify 16 ASCII bytes without a table lookup.
+static utf8_inline __m128i ascii_props_16(__m128i v) {
+  const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  const __m128i alpha = in_range_epi8(lower, 'a', 'z');
+  const __m128i digit = in_range_epi8(v, '0', '9');
+  const __m128i space = _mm_or_si128(in_range_epi8(v, '\t', '\r'),
+                                     _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+  const __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+
+  __m128i res = _mm_and_si128(
+      alpha, _mm_set1_epi8(UTF8_PROP_ALPHA | UTF8_PROP_XID_START |
+                           UTF8_PROP_XID_CONTINUE));
+  res = _mm_or_si128(
+      res, _mm_and_si128(digit, _mm_set1_epi8(UTF8_PROP_DIGIT |
+                                              UTF8_PROP_XID_CONTINUE)));
+  res = _mm_or_si128(res, _mm_and_si128(space, _mm_set1_epi8(UTF8_PROP_SPACE)));
+  return _mm_or_si128(
+      res, _mm_and_si128(underscore, _mm_set1_epi8(UTF8_PROP_XID_CONTINUE)));
+}
+#endif
+
+size_t utf8_classify(const utf8_chr *const s, size_t len,
+                     uint8_t *const props) {
+  const uint8_t *const b = (const uint8_t *)s;
+  size_t i = 0;
+  size_t n = 0;
+
+  while (i < len) {
+#if defined(__SSE2__)
+    // ASCII runs: bytes and symbols line up, 16 at a time.
+    while (i + 16 <= len) {
+      const __m128i v = _mm_loadu_si128((const __m128i *)(b + i));
+      if (_mm_movemask_epi8(v) != 0)
+        break;
+      _mm_storeu_si128((__m128i *)(props + n), ascii_props_16(v));
+      i += 16;
+      n += 16;
+    }
+    if (i == len)
+      break;
+#endif
+    if (b[i] < 0x80) {
+      props[n++] = utf8_ascii_props[b[i++]];
+      continue;
+    }
+
+    utf8_code_pt c;
+    const int nbytes = utf8_decode_next(s + i, len - i, &c);
+    if (nbytes < 1) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      props[n++] = 0;
+      i++;
+      continue;
+    }
+    props[n++] = utf8_codepoint_props_slow(c);
+    i += nbytes;
+  }
+  return n;
+}
@@ -0,0 +1,66 @@
+#ifndef KL_UTF8_PROPS_H
+#define KL_UTF8_PROPS_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Unicode character properties for lexers, independent of the C locale.
+// Each codepoint has a mask of the following bits.
+enum utf8_prop {
+  // Alphabetic
+  UTF8_PROP_ALPHA = 1 << 0,
+  // General_Category Nd (decimal digits of all scripts)
+  UTF8_PROP_DIGIT = 1 << 1,
+  // White_Space
+  UTF8_PROP_SPACE = 1 << 2,
+  // XID_Start and XID_Continue, see UAX #31. Identifiers start with a
+  // XID_Start codepoint, followed by XID_Continue codepoints.
+  UTF8_PROP_XID_START = 1 << 3,
+  UTF8_PROP_XID_CONTINUE = 1 << 4,
+};
+
+// Properties of the ASCII codepoints.
+extern const uint8_t utf8_ascii_props[128];
+
+// Properties of a codepoint. Invalid codepoints have none.
+uint8_t utf8_codepoint_props_slow(utf8_code_pt c);
+
+static inline uint8_t utf8_codepoint_props(utf8_code_pt c) {
+  return c < 0x80 ? utf8_ascii_props[c] : utf8_codepoint_props_slow(c);
+}
+
+static inline bool utf8_isalpha(utf8_code_pt c) {
+  return (utf8_codepoint_props(c) & UTF8_PROP_ALPHA) != 0;
+}
+
+static inline bool utf8_isdigit(utf8_code_pt c) {
+  return (utf8_codepoint_props(c) & UTF8_PROP_DIGIT) != 0;
+}
+
+static inline bool utf8_isspace(utf8_code_pt c) {
+  return (utf8_codepoint_props(c) & UTF8_PROP_SPACE) != 0;
+}
+
+static inline bool utf8_is_xid_start(utf8_code_pt c) {
+  return (utf8_codepoint_props(c) & UTF8_PROP_XID_START) != 0;
+}
+
+static inline bool utf8_is_xid_continue(utf8_code_pt c) {
+  return (utf8_codepoint_props(c) & UTF8_PROP_XID_CONTINUE) != 0;
+}
+
+// Classify every symbol of a len byte string. props[i] receives the
+// properties of the i-th symbol, so props needs room for len entries.
+// Invalid bytes get no properties and set utf8_lib_error.
+// Returns the number of symbols.
+size_t utf8_classify(const utf8_chr *const s, size_t len,
+                     uint8_t *const props);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_PROPS_H
@@ -0,0 +1,74 @@
+#include "utest/utest.h"
+#include "utf8_props.h"
+
+#define U8(s) utf8_reinterpret_string(s)
+
+UTEST(utf8_props, codepoints) {
+  ASSERT_TRUE(utf8_isalpha('a'));
+  ASSERT_TRUE(utf8_isalpha(0x03BB)); // λ
+  ASSERT_TRUE(utf8_isalpha(0x4E2D)); // 中
+  ASSERT_FALSE(utf8_isalpha('1'));
+  ASSERT_FALSE(utf8_isalpha(0x20AC)); // €
+
+  ASSERT_TRUE(utf8_isdigit('7'));
+  ASSERT_TRUE(utf8_isdigit(0x0663)); // Arabic-Indic three
+  ASSERT_FALSE(utf8_isdigit(0x00B2)); // superscript two is No, not Nd
+  ASSERT_FALSE(utf8_isdigit('x'));
+
+  ASSERT_TRUE(utf8_isspace(' '));
+  ASSERT_TRUE(utf8_isspace('\n'));
+  ASSERT_TRUE(utf8_isspace(0x00A0));
+  ASSERT_TRUE(utf8_isspace(0x3000));
+  ASSERT_FALSE(utf8_isspace(0x200B)); // zero width space is not White_Space
+
+  ASSERT_TRUE(utf8_is_xid_start('Z'));
+  ASSERT_FALSE(utf8_is_xid_start('_'));
+  ASSERT_TRUE(utf8_is_xid_continue('_'));
+  ASSERT_FALSE(utf8_is_xid_start('5'));
+  ASSERT_TRUE(utf8_is_xid_continue('5'));
+  ASSERT_TRUE(utf8_is_xid_continue(0x0301)); // combining acute accent
+  ASSERT_FALSE(utf8_is_xid_start(0x0301));
+  ASSERT_TRUE(utf8_is_xid_continue(0x00B7)); // middle dot
+  ASSERT_TRUE(utf8_is_xid_start(0x1D400));   // mathematical bold A
+
+  ASSERT_EQ(utf8_codepoint_props(0xE000), 0);   // private use
+  ASSERT_EQ(utf8_codepoint_props(0x10FFFF), 0);
+  ASSERT_EQ(utf8_codepoint_props(0x110000), 0);
+}
+
+UTEST(utf8_props, ascii_table) {
+  for (utf8_code_pt c = 0; c < 0x80; c++)
+    ASSERT_EQ(utf8_ascii_props[c], utf8_codepoint_props_slow(c));
+}
+
+UTEST(utf8_props, classify) {
+  // ASCII runs of all lengths, so that the vectorized path is taken and left
+  // at every position.
+  char s[300];
+  uint8_t props[300];
+  for (int i = 0; i < 300; i++)
+    s[i] = (char)((i * 7 + 3) % 128);
+  for (size_t len = 0; len <= 300; len++) {
+    ASSERT_EQ(utf8_classify(U8(s), len, props), len);
+    for (size_t i = 0; i < len; i++)
+      ASSERT_EQ(props[i], utf8_ascii_props[(uint8_t)s[i]]);
+  }
+
+  // "x = λ٣ 中_"
+  const char *m = "x = \xCE\xBB\xD9\xA3 \xE4\xB8\xAD_";
+  ASSERT_EQ(utf8_classify(U8(m), strlen(m), props), (size_t)9);
+  ASSERT_EQ(props[0], utf8_codepoint_props('x'));
+  ASSERT_EQ(props[1], UTF8_PROP_SPACE);
+  ASSERT_EQ(props[2], 0);
+  ASSERT_EQ(props[4], utf8_codepoint_props(0x03BB));
+  ASSERT_TRUE(props[5] & UTF8_PROP_DIGIT);
+  ASSERT_TRUE(props[7] & UTF8_PROP_ALPHA);
+  ASSERT_EQ(props[8], UTF8_PROP_XID_CONTINUE);
+
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_classify(U8("a\xFF" "b"), 3, props), (size_t)3);
+  ASSERT_EQ(props[1], 0);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+}
+
+UTEST_MAIN()
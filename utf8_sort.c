@@ -0,0 +1,224 @@
+#include "utf8_sort.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Buckets smaller than this are sorted by insertion sort.
+#define INSERTION_THRESHOLD 32
+
+struct item {
+  // The 8 bytes of s starting at the current depth, as a big endian number,
+  // so comparing keys compares the bytes. Bytes after the end are 0.
+  uint64_t key;
+  const utf8_chr *s;
+};
+
+static inline uint64_t load_key(const utf8_chr *s) {
+  uint64_t key = 0;
+  int i = 0;
+  for (; i < 8 && s[i] != 0; i++)
+    key = (key << 8) | (uint8_t)s[i];
+  return i == 0 ? 0 : key << (64 - 8 * i);
+}
+
+static inline int item_cmp(const struct item *a, const struct item *b,
+                           size_t depth) {
+  if (a->key != b->key)
+    return a->key < b->key ? -1 : 1;
+  // Both strings end inside of the key.
+  if ((a->key & 0xFF) == 0)
+    return 0;
+  return strcmp(a->s + depth + 8, b->s + depth + 8);
+}
+
+static void insertion_sort(struct item *a, size_t n, size_t depth) {
+  for (size_t i = 1; i < n; i++) {
+    const struct item x = a[i];
+    size_t j = i;
+    while (j > 0 && item_cmp(&x, &a[j - 1], depth) < 0) {
+      a[j] = a[j - 1];
+      j--;
+    }
+    a[j] = x;
+  }
+}
+
+// Sort items which are equal up to byte `byte` of their keys. tmp has room
+// for n items.
+static void msd(struct item *a, struct item *tmp, size_t n, size_t depth,
+                int byte) {
+  size_t count[256];
+  size_t start[256];
+
+  // The largest bucket is sorted in this loop instead of by recursion, which
+  // keeps the recursion depth logarithmic.
+  for (;;) {
+    if (n < INSERTION_THRESHOLD) {
+      insertion_sort(a, n, depth);
+      return;
+    }
+    if (byte == 8) {
+      depth += 8;
+      byte = 0;
+      for (size_t i = 0; i < n; i++)
+        a[i].key = load_key(a[i].s + depth);
+    }
+
+    const int shift = 56 - 8 * byte;
+    memset(count, 0, sizeof(count));
+    for (size_t i = 0; i < n; i++)
+      count[(a[i].key >> shift) & 0xFF]++;
+
+    // All strings share this byte. A 0 means that they all end here.
+    const unsigned first = (a[0].key >> shift) & 0xFF;
+    if (count[first] == n) {
+      if (first == 0)
+        return;
+      byte++;
+      continue;
+    }
+
+    size_t pos = 0;
+    for (int d = 0; d < 256; d++) {
+      start[d] = pos;
+      pos += count[d];
+    }
+    for (size_t i = 0; i < n; i++)
+      tmp[start[(a[i].key >> shift) & 0xFF]++] = a[i];
+    memcpy(a, tmp, n * sizeof(struct item));
+
+    // start[d] now is the end of bucket d. Bucket 0 holds strings which end
+    // here and is already sorted.
+    int largest = 1;
+    for (int d = 1; d < 256; d++) {
+      if (count[d] > count[largest])
+        largest = d;
+    }
+    for (int d = 1; d < 256; d++) {
+      if (d != largest && count[d] > 1) {
+        const size_t begin = start[d] - count[d];
+        msd(a + begin, tmp + begin, count[d], depth, byte + 1);
+      }
+    }
+    const size_t begin = start[largest] - count[largest];
+    a += begin;
+    tmp += begin;
+    n = count[largest];
+    byte++;
+  }
+}
+
+static struct item *make_items(const utf8_chr **strs, size_t n) {
+  struct item *items = malloc(2 * n * sizeof(struct item));
+  if (!items)
+    return NULL;
+  for (size_t i = 0; i < n; i++) {
+    items[i].key = load_key(strs[i]);
+    items[i].s = strs[i];
+  }
+  return items;
+}
+
+bool utf8_sort(const utf8_chr **strs, size_t n) {
+  if (n < 2)
+    return true;
+  struct item *items = make_items(strs, n);
+  if (!items)
+    return false;
+  msd(items, items + n, n, 0, 0);
+  for (size_t i = 0; i < n; i++)
+    strs[i] = items[i].s;
+  free(items);
+  return true;
+}
+
+// Buckets of the first two bytes.
+#define TOP_BUCKETS 65536
+
+struct sort_job {
+  struct item *items;
+  struct item *tmp;
+  const size_t *start;
+  const size_t *count;
+  // Buckets which still have to be sorted, largest first. The lower 16 bits
+  // are the bucket, the others its size.
+  const uint64_t *order;
+  size_t order_len;
+  atomic_size_t next;
+};
+
+static void *sort_worker(void *arg) {
+  struct sort_job *job = arg;
+  for (;;) {
+    const size_t i = atomic_fetch_add(&job->next, 1);
+    if (i >= job->order_len)
+      return NULL;
+    const size_t b = job->order[i] & 0xFFFF;
+    msd(job->items + job->start[b], job->tmp + job->start[b], job->count[b],
+        0, 2);
+  }
+}
+
+static int descending(const void *x, const void *y) {
+  const uint64_t a = *(const uint64_t *)x;
+  const uint64_t b = *(const uint64_t *)y;
+  return a < b ? 1 : a > b ? -1 : 0;
+}
+
+bool utf8_sort_parallel(const utf8_chr **strs, size_t n, unsigned threads) {
+  if (threads <= 1 || n < TOP_BUCKETS)
+    return utf8_sort(strs, n);
+
+  struct item *items = make_items(strs, n);
+  size_t *count = calloc(TOP_BUCKETS, sizeof(size_t));
+  size_t *start = malloc(TOP_BUCKETS * sizeof(size_t));
+  uint64_t *order = malloc(TOP_BUCKETS * sizeof(uint64_t));
+  pthread_t *ids = malloc(threads * sizeof(pthread_t));
+  bool ok = items && count && start && order && ids;
+  if (!ok)
+    goto done;
+
+  struct item *tmp = items + n;
+  for (size_t i = 0; i < n; i++)
+    count[items[i].key >> 48]++;
+  size_t pos = 0;
+  for (size_t b = 0; b < TOP_BUCKETS; b++) {
+    start[b] = pos;
+    pos += count[b];
+  }
+  for (size_t i = 0; i < n; i++)
+    tmp[start[items[i].key >> 48]++] = items[i];
+  memcpy(items, tmp, n * sizeof(struct item));
+
+  // Buckets where the first or second byte is 0 hold equal strings.
+  size_t order_len = 0;
+  for (size_t b = 0; b < TOP_BUCKETS; b++) {
+    start[b] -= count[b];
+    if ((b >> 8) != 0 && (b & 0xFF) != 0 && count[b] > 1)
+      order[order_len++] = ((uint64_t)count[b] << 16) | b;
+  }
+  qsort(order, order_len, sizeof(uint64_t), descending);
+
+  struct sort_job job = {items, tmp, start, count, order, order_len, 0};
+  unsigned started = 0;
+  for (; started < threads - 1; started++) {
+    if (pthread_create(&ids[started], NULL, sort_worker, &job) != 0)
+      break;
+  }
+  sort_worker(&job);
+  for (unsigned t = 0; t < started; t++)
+    pthread_join(ids[t], NULL);
+
+  for (size_t i = 0; i < n; i++)
+    strs[i] = items[i].s;
+
+done:
+  free(items);
+  free(count);
+  free(start);
+  free(order);
+  free(ids);
+  return ok;
+}
@@ -0,0 +1,34 @@
+#ifndef KL_UTF8_SORT_H
+#define KL_UTF8_SORT_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sort an array of 0-terminated strings in ascending order.
+// For valid UTF-8, the byte order of two strings is the same as the order of
+// their codepoints, so the result is ordered by codepoints like utf8_str_cmp.
+// Strings which are a prefix of others come first.
+// Invalid strings are sorted by their bytes and do not set utf8_lib_error.
+//
+// The strings are sorted with an MSD radix sort, which caches the next 8
+// bytes of every string next to its pointer, so most steps never touch the
+// strings themselves and no byte is compared twice.
+//
+// Returns false if memory could not be allocated. The array is unchanged in
+// that case.
+bool utf8_sort(const utf8_chr **strs, size_t n);
+
+// Same as utf8_sort, but sorts with up to `threads` threads. The strings are
+// split by their first two bytes (so text in a single script, which often
+// shares the first byte, still spreads across threads) and the buckets are
+// handed out to the threads largest first.
+bool utf8_sort_parallel(const utf8_chr **strs, size_t n, unsigned threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_SORT_H
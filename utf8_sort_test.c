@@ -0,0 +1,115 @@
+#include "utest/utest.h"
+#include "utf8_sort.h"
+
+#include <stdlib.h>
+
+static int cmp_bytes(const void *x, const void *y) {
+  return strcmp(*(const char *const *)x, *(const char *const *)y);
+}
+
+// Random strings of symbols from a small alphabet, with shared prefixes,
+// duplicates and empty strings.
+static char **random_strings(size_t n, unsigned seed) {
+  const char *symbols[] = {"a", "b", "\xCE\xBB", "\xCE\xBC", "\xD0\x96",
+                           "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "~"};
+  const char *prefix = "common prefix which is longer than the key ";
+  char **strs = malloc(n * sizeof(char *));
+  for (size_t i = 0; i < n; i++) {
+    seed = seed * 1103515245 + 12345;
+    char buf[128] = {0};
+    size_t len = 0;
+    if ((seed >> 16) % 3 == 0) {
+      strcpy(buf, prefix);
+      len = strlen(prefix);
+    }
+    seed = seed * 1103515245 + 12345;
+    const unsigned symbols_n = (seed >> 16) % 12;
+    for (unsigned j = 0; j < symbols_n; j++) {
+      seed = seed * 1103515245 + 12345;
+      const char *sym = symbols[(seed >> 16) % 8];
+      memcpy(buf + len, sym, strlen(sym));
+      len += strlen(sym);
+    }
+    strs[i] = malloc(len + 1);
+    memcpy(strs[i], buf, len + 1);
+  }
+  return strs;
+}
+
+static void free_strings(char **strs, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    free(strs[i]);
+  free(strs);
+}
+
+UTEST(utf8_sort, small) {
+  const utf8_chr *strs[] = {"\xCE\xBB", "b", "", "ab", "a", "\xE2\x82\xAC",
+                            "a", "~"};
+  ASSERT_TRUE(utf8_sort(strs, 8));
+  ASSERT_STREQ(strs[0], "");
+  ASSERT_STREQ(strs[1], "a");
+  ASSERT_STREQ(strs[2], "a");
+  ASSERT_STREQ(strs[3], "ab");
+  ASSERT_STREQ(strs[4], "b");
+  ASSERT_STREQ(strs[5], "~");
+  ASSERT_STREQ(strs[6], "\xCE\xBB");
+  ASSERT_STREQ(strs[7], "\xE2\x82\xAC");
+  ASSERT_TRUE(utf8_sort(strs, 0));
+}
+
+UTEST(utf8_sort, sorted) {
+  const size_t n = 5000;
+  char **strs = random_strings(n, 1);
+  const utf8_chr **a = malloc(n * sizeof(char *));
+  const utf8_chr **b = malloc(n * sizeof(char *));
+  memcpy(a, strs, n * sizeof(char *));
+  memcpy(b, strs, n * sizeof(char *));
+
+  ASSERT_TRUE(utf8_sort(a, n));
+  qsort(b, n, sizeof(char *), cmp_bytes);
+  for (size_t i = 0; i < n; i++)
+    ASSERT_STREQ(a[i], b[i]);
+  // utf8_str_cmp treats a prefix as equal, so only check neighbours.
+  for (size_t i = 1; i < n; i++)
+    ASSERT_LE(utf8_str_cmp(a[i - 1], a[i]), 0);
+
+  free(a);
+  free(b);
+  free_strings(strs, n);
+}
+
+UTEST(utf8_sort, long_common_prefix) {
+  // Strings "x", "xx", "xxx", ... in reverse order.
+  const size_t n = 3000;
+  char *buf = malloc(n + 1);
+  const utf8_chr **strs = malloc(n * sizeof(char *));
+  memset(buf, 'x', n);
+  buf[n] = 0;
+  for (size_t i = 0; i < n; i++)
+    strs[i] = buf + i;
+  ASSERT_TRUE(utf8_sort(strs, n));
+  for (size_t i = 0; i < n; i++)
+    ASSERT_EQ(strlen(strs[i]), i + 1);
+  free(strs);
+  free(buf);
+}
+
+UTEST(utf8_sort, parallel) {
+  const size_t n = 200000;
+  char **strs = random_strings(n, 2);
+  const utf8_chr **a = malloc(n * sizeof(char *));
+  const utf8_chr **b = malloc(n * sizeof(char *));
+  memcpy(a, strs, n * sizeof(char *));
+  memcpy(b, strs, n * sizeof(char *));
+
+  ASSERT_TRUE(utf8_sort_parallel(a, n, 4));
+  qsort(b, n, sizeof(char *), cmp_bytes);
+  for (size_t i = 0; i < n; i++)
+    ASSERT_STREQ(a[i], b[i]);
+
+  free(a);
+  free(b);
+  free_strings(strs, n);
+}
+
+UTEST_MAIN()
@@ -0,0 +1,61 @@
+#ifndef KL_UTF8_STATS_H
+#define KL_UTF8_STATS_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Coarse groups of scripts. Symbols are sorted in by blocks of 16
+// codepoints, so a few symbols at the edges of scripts end up in a
+// neighbouring group.
+// UTF8_SCRIPT_COMMON: Digits, punctuation, symbols, emoji and combining
+//   marks, which are used by every script.
+// UTF8_SCRIPT_INDIC: Devanagari, Bengali, Gurmukhi, Gujarati, Oriya, Tamil,
+//   Telugu, Kannada, Malayalam and Sinhala.
+// UTF8_SCRIPT_THAI: Thai and Lao.
+// UTF8_SCRIPT_HAN: Han ideographs and Bopomofo.
+// UTF8_SCRIPT_KANA: Hiragana and Katakana.
+// UTF8_SCRIPT_OTHER: Every other script and unassigned codepoints.
+enum utf8_script {
+  UTF8_SCRIPT_COMMON,
+  UTF8_SCRIPT_LATIN,
+  UTF8_SCRIPT_GREEK,
+  UTF8_SCRIPT_CYRILLIC,
+  UTF8_SCRIPT_HEBREW,
+  UTF8_SCRIPT_ARABIC,
+  UTF8_SCRIPT_INDIC,
+  UTF8_SCRIPT_THAI,
+  UTF8_SCRIPT_HAN,
+  UTF8_SCRIPT_KANA,
+  UTF8_SCRIPT_HANGUL,
+  UTF8_SCRIPT_OTHER,
+  UTF8_SCRIPT_COUNT,
+};
+
+struct utf8_stats {
+  // symbols[n - 1] is the number of valid symbols of n bytes.
+  size_t symbols[4];
+  // Bytes which are not part of a valid symbol.
+  size_t invalid;
+  // Number of lines. A last line without '\n' at the end is counted too.
+  size_t lines;
+  // Number of valid symbols of each enum utf8_script.
+  size_t scripts[UTF8_SCRIPT_COUNT];
+};
+
+// Group of a codepoint. See enum utf8_script.
+enum utf8_script utf8_codepoint_script(utf8_code_pt c);
+
+// Count the symbols of the first len bytes of s in a single pass. Blocks of
+// 16 ASCII bytes are counted with SSE2 where it is available. Invalid bytes
+// are counted one by one and do not stop the pass.
+void utf8_stats(const utf8_chr *const s, size_t len,
+                struct utf8_stats *const stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_STATS_H
@@ -0,0 +1,99 @@
+#include "utest/utest.h"
+#include "utf8_stats.h"
+
+#define U8(s) utf8_reinterpret_string(s)
+
+static int script(utf8_code_pt c) { return utf8_codepoint_script(c); }
+
+UTEST(utf8_stats, scripts) {
+  ASSERT_EQ(script('a'), UTF8_SCRIPT_LATIN);
+  ASSERT_EQ(script('7'), UTF8_SCRIPT_COMMON);
+  ASSERT_EQ(script(0xE9), UTF8_SCRIPT_LATIN);
+  ASSERT_EQ(script(0x3BB), UTF8_SCRIPT_GREEK);
+  ASSERT_EQ(script(0x416), UTF8_SCRIPT_CYRILLIC);
+  ASSERT_EQ(script(0x5D0), UTF8_SCRIPT_HEBREW);
+  ASSERT_EQ(script(0x628), UTF8_SCRIPT_ARABIC);
+  ASSERT_EQ(script(0x915), UTF8_SCRIPT_INDIC);
+  ASSERT_EQ(script(0xE01), UTF8_SCRIPT_THAI);
+  ASSERT_EQ(script(0x4E2D), UTF8_SCRIPT_HAN);
+  ASSERT_EQ(script(0x20000), UTF8_SCRIPT_HAN);
+  ASSERT_EQ(script(0x3042), UTF8_SCRIPT_KANA);
+  ASSERT_EQ(script(0x30A2), UTF8_SCRIPT_KANA);
+  ASSERT_EQ(script(0xAC00), UTF8_SCRIPT_HANGUL);
+  ASSERT_EQ(script(0x1F600), UTF8_SCRIPT_COMMON);
+  ASSERT_EQ(script(0x2014), UTF8_SCRIPT_COMMON);
+  ASSERT_EQ(script(0x10A0), UTF8_SCRIPT_OTHER); // Georgian
+}
+
+UTEST(utf8_stats, counts) {
+  struct utf8_stats st;
+  utf8_stats(U8(""), 0, &st);
+  ASSERT_EQ(st.lines, (size_t)0);
+  ASSERT_EQ(st.symbols[0], (size_t)0);
+
+  // "Grüße, 世界!\n" and a line without newline.
+  const char *text = "Gr\xC3\xBC\xC3\x9F" "e, \xE4\xB8\x96\xE7\x95\x8C!\n"
+                     "\xF0\x9F\x98\x80\xFF";
+  utf8_stats(U8(text), strlen(text), &st);
+  ASSERT_EQ(st.symbols[0], (size_t)7);
+  ASSERT_EQ(st.symbols[1], (size_t)2);
+  ASSERT_EQ(st.symbols[2], (size_t)2);
+  ASSERT_EQ(st.symbols[3], (size_t)1);
+  ASSERT_EQ(st.invalid, (size_t)1);
+  ASSERT_EQ(st.lines, (size_t)2);
+  ASSERT_EQ(st.scripts[UTF8_SCRIPT_LATIN], (size_t)5);
+  ASSERT_EQ(st.scripts[UTF8_SCRIPT_HAN], (size_t)2);
+  ASSERT_EQ(st.scripts[UTF8_SCRIPT_COMMON], (size_t)5);
+
+  // A symbol cut off at the end is invalid byte by byte.
+  utf8_stats(U8("ab\n\xE4\xB8"), 5, &st);
+  ASSERT_EQ(st.symbols[0], (size_t)3);
+  ASSERT_EQ(st.invalid, (size_t)2);
+  ASSERT_EQ(st.lines, (size_t)2);
+}
+
+// Compare with a plain loop over random mixes of ASCII runs, symbols of all
+// lengths and stray bytes, which cross the 16 byte blocks at every offset.
+UTEST(utf8_stats, random) {
+  static const char *pieces[] = {"abcdefghijklmnopqrstuvwxyz0123",
+                                 "\n", " ", "\xC3\xA9", "\xD0\x96",
+                                 "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\x80",
+                                 "\xE4\xB8", "Z"};
+  char buf[4096];
+  unsigned seed = 7;
+  for (int round = 0; round < 200; round++) {
+    size_t len = 0;
+    while (len + 40 < sizeof(buf)) {
+      seed = seed * 1103515245 + 12345;
+      const char *p = pieces[(seed >> 16) % 10];
+      const size_t n = p[0] == 'a' ? (seed >> 8) % 31 : strlen(p);
+      memcpy(buf + len, p, n);
+      len += n;
+      if ((seed >> 4) % 97 == 0)
+        break;
+    }
+
+    struct utf8_stats expected;
+    memset(&expected, 0, sizeof(expected));
+    for (size_t i = 0; i < len;) {
+      utf8_code_pt c;
+      const int n = utf8_decode_next(U8(buf) + i, len - i, &c);
+      if (n < 1) {
+        expected.invalid++;
+        i++;
+        continue;
+      }
+      expected.symbols[n - 1]++;
+      expected.scripts[utf8_codepoint_script(c)]++;
+      expected.lines += c == '\n';
+      i += n;
+    }
+    expected.lines += len > 0 && buf[len - 1] != '\n';
+
+    struct utf8_stats st;
+    utf8_stats(U8(buf), len, &st);
+    ASSERT_EQ(memcmp(&st, &expected, sizeof(st)), 0);
+  }
+}
+
+UTEST_MAIN()
@@ -611,4 +611,528 @@ UTEST(utf8_string_valid, invalid) {
   ASSERT_EQ(err, 0);
 }
 
+// Symbols with the right bit patterns which are still not valid UTF-8.
+UTEST(utf8_string_valid, strict) {
+  const char *invalid[] = {
+      "\xC0\x80",         // Overlong 0
+      "\xC1\xBF",         // Overlong U+007F
+      "\xE0\x9F\xBF",     // Overlong U+07FF
+      "\xF0\x8F\xBF\xBF", // Overlong U+FFFF
+      "\xED\xA0\x80",     // Surrogate U+D800
+      "\xED\xBF\xBF",     // Surrogate U+DFFF
+      "\xF4\x90\x80\x80", // U+110000
+      "\xF5\x80\x80\x80", // U+140000
+  };
+  const char *valid[] = {"\xC2\x80", "\xE0\xA0\x80", "\xED\x9F\xBF",
+                         "\xEE\x80\x80", "\xF0\x90\x80\x80",
+                         "\xF4\x8F\xBF\xBF"};
+  utf8_code_pt c;
+
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(*invalid); i++) {
+    const utf8_chr *s = utf8_reinterpret_string(invalid[i]);
+    const size_t len = strlen(invalid[i]);
+    bool batch;
+    ASSERT_FALSE(utf8_char_valid(s));
+    ASSERT_FALSE(utf8_string_valid(s));
+    ASSERT_LT(utf8_decode_next(s, len, &c), 1);
+    struct utf8_span span = utf8_span_make(s, len);
+    ASSERT_FALSE(utf8_span_valid(&span));
+    utf8_valid_batch(&s, &len, 1, &batch);
+    ASSERT_FALSE(batch);
+  }
+  for (size_t i = 0; i < sizeof(valid) / sizeof(*valid); i++) {
+    const utf8_chr *s = utf8_reinterpret_string(valid[i]);
+    const size_t len = strlen(valid[i]);
+    bool batch;
+    ASSERT_TRUE(utf8_char_valid(s));
+    ASSERT_TRUE(utf8_string_valid(s));
+    ASSERT_EQ(utf8_decode_next(s, len, &c), (int)len);
+    struct utf8_span span = utf8_span_make(s, len);
+    ASSERT_TRUE(utf8_span_valid(&span));
+    utf8_valid_batch(&s, &len, 1, &batch);
+    ASSERT_TRUE(batch);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_decode_prev and utf8_prev                          //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_prev, valid) {
+  TEST_SETUP();
+  // "aλ€😀"
+  const char *s = "a\xCE\xBB\xE2\x82\xAC\xF0\x9F\x98\x80";
+  const utf8_chr *str = utf8_reinterpret_string(s);
+  utf8_code_pt c;
+  (void)buff_ptr;
+
+  ASSERT_EQ(utf8_decode_prev(str, 10, &c), 4);
+  ASSERT_EQ(c, (utf8_code_pt)0x1F600);
+  ASSERT_EQ(utf8_decode_prev(str, 6, &c), 3);
+  ASSERT_EQ(c, (utf8_code_pt)0x20AC);
+  ASSERT_EQ(utf8_decode_prev(str, 3, &c), 2);
+  ASSERT_EQ(c, (utf8_code_pt)0x03BB);
+  ASSERT_EQ(utf8_decode_prev(str, 1, &c), 1);
+  ASSERT_EQ(c, (utf8_code_pt)'a');
+  ASSERT_EQ(utf8_decode_prev(str, 0, &c), 0);
+
+  ASSERT_EQ(utf8_prev(str, 10), (size_t)6);
+  ASSERT_EQ(utf8_prev(str, 6), (size_t)3);
+  ASSERT_EQ(utf8_prev(str, 3), (size_t)1);
+  ASSERT_EQ(utf8_prev(str, 1), (size_t)0);
+  ASSERT_EQ(utf8_prev(str, 0), (size_t)0);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, 0);
+}
+
+UTEST(utf8_prev, invalid) {
+  TEST_SETUP();
+  utf8_code_pt c;
+  (void)buff_ptr;
+
+  // Cut off symbol.
+  const utf8_chr *str = utf8_reinterpret_string("a\xE2\x82");
+  ASSERT_LT(utf8_decode_prev(str, 3, &c), 0);
+  ASSERT_EQ(utf8_prev(str, 3), (size_t)2);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_UTF8_SYMBOL);
+
+  // Too many continuation bytes. Only 4 bytes are looked at.
+  set_utf8_lib_error(0);
+  str = utf8_reinterpret_string("\xF0\x9F\x98\x80\x80");
+  ASSERT_LT(utf8_decode_prev(str, 5, &c), 0);
+  ASSERT_EQ(utf8_prev(str, 5), (size_t)4);
+  ASSERT_EQ(utf8_prev(str, 4), (size_t)0);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_UTF8_SYMBOL);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_truncate_bytes                                     //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_truncate_bytes, symbol_boundaries) {
+  // "aλ€😀b"
+  const char *s = "a\xCE\xBB\xE2\x82\xAC\xF0\x9F\x98\x80" "b";
+  const utf8_chr *str = utf8_reinterpret_string(s);
+  const size_t expected[] = {0, 1, 1, 3, 3, 3, 6, 6, 6, 6, 10, 11, 11};
+  for (size_t max = 0; max < sizeof(expected) / sizeof(size_t); max++)
+    ASSERT_EQ(utf8_truncate_bytes(str, 11, max), expected[max]);
+
+  // Stray continuation bytes count as symbols of their own.
+  str = utf8_reinterpret_string("ab\x80\x80\x80\x80\x80");
+  ASSERT_EQ(utf8_truncate_bytes(str, 7, 4), (size_t)4);
+  str = utf8_reinterpret_string("\xFF\x80");
+  ASSERT_EQ(utf8_truncate_bytes(str, 2, 1), (size_t)1);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_suffix_offset                                      //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_suffix_offset, counts_back) {
+  TEST_SETUP();
+  const char *s = "a\xCE\xBB\xE2\x82\xAC\xF0\x9F\x98\x80";
+  const utf8_chr *str = utf8_reinterpret_string(s);
+  (void)buff_ptr;
+
+  ASSERT_EQ(utf8_suffix_offset(str, 10, 0), (size_t)10);
+  ASSERT_EQ(utf8_suffix_offset(str, 10, 1), (size_t)6);
+  ASSERT_EQ(utf8_suffix_offset(str, 10, 3), (size_t)1);
+  ASSERT_EQ(utf8_suffix_offset(str, 10, 4), (size_t)0);
+  ASSERT_EQ(utf8_suffix_offset(str, 10, 100), (size_t)0);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, 0);
+
+  str = utf8_reinterpret_string("\x82\xAC" "ab");
+  ASSERT_EQ(utf8_suffix_offset(str, 4, 2), (size_t)2);
+  ASSERT_EQ(utf8_suffix_offset(str, 4, 3), SIZE_MAX);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_UTF8_SYMBOL);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_casefold_codepoint                                 //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_casefold_codepoint, scripts) {
+  ASSERT_EQ(utf8_casefold_codepoint('A'), (utf8_code_pt)'a');
+  ASSERT_EQ(utf8_casefold_codepoint('z'), (utf8_code_pt)'z');
+  ASSERT_EQ(utf8_casefold_codepoint('@'), (utf8_code_pt)'@');
+  ASSERT_EQ(utf8_casefold_codepoint(0xC4), (utf8_code_pt)0xE4);     // Ä
+  ASSERT_EQ(utf8_casefold_codepoint(0x0100), (utf8_code_pt)0x0101); // Ā
+  ASSERT_EQ(utf8_casefold_codepoint(0x0101), (utf8_code_pt)0x0101); // ā
+  ASSERT_EQ(utf8_casefold_codepoint(0x039B), (utf8_code_pt)0x03BB); // Λ
+  ASSERT_EQ(utf8_casefold_codepoint(0x03C2), (utf8_code_pt)0x03C3); // ς
+  ASSERT_EQ(utf8_casefold_codepoint(0x0416), (utf8_code_pt)0x0436); // Ж
+  ASSERT_EQ(utf8_casefold_codepoint(0x212A), (utf8_code_pt)'k');    // Kelvin
+  ASSERT_EQ(utf8_casefold_codepoint(0x1E9E), (utf8_code_pt)0xDF);   // ẞ
+  ASSERT_EQ(utf8_casefold_codepoint(0x10400), (utf8_code_pt)0x10428);
+  ASSERT_EQ(utf8_casefold_codepoint(0x4E2D), (utf8_code_pt)0x4E2D);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_escape                                             //
+//////////////////////////////////////////////////////////////////////
+
+#define ASSERT_ESCAPE(style, in, in_len, expected)                             \
+  do {                                                                         \
+    const size_t size =                                                        \
+        utf8_escaped_size(utf8_reinterpret_string(in), in_len, style);         \
+    ASSERT_EQ(size, strlen(expected));                                         \
+    clear_buff(buff);                                                          \
+    ASSERT_EQ(utf8_escape(utf8_reinterpret_string(in), in_len, style,          \
+                          buff_ptr),                                           \
+              size);                                                           \
+    ASSERT_STREQ(buff, expected);                                              \
+  } while (0)
+
+UTEST(utf8_escape, json) {
+  TEST_SETUP();
+  (void)err;
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "abc", 3, "abc");
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "a\"b\\c\n", 6, "a\\\"b\\\\c\\n");
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "\x01\x7F", 2, "\\u0001\x7F");
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "a\0b", 3, "a\\u0000b");
+  // Non-ASCII symbols are not escaped.
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "\xCE\xBB\t", 3, "\xCE\xBB\\t");
+  // Long clean runs before and after a special character.
+  ASSERT_ESCAPE(UTF8_ESCAPE_JSON, "0123456789abcdefghij\"0123456789abcdefghij",
+                41, "0123456789abcdefghij\\\"0123456789abcdefghij");
+}
+
+UTEST(utf8_escape, c_and_shell) {
+  TEST_SETUP();
+  (void)err;
+  ASSERT_ESCAPE(UTF8_ESCAPE_C, "a\"b\\c\n", 6, "a\\\"b\\\\c\\n");
+  ASSERT_ESCAPE(UTF8_ESCAPE_C, "\x01"
+                               "1\x7F",
+                3, "\\0011\\177");
+  ASSERT_ESCAPE(UTF8_ESCAPE_SHELL, "it's", 4, "'it'\\''s'");
+  ASSERT_ESCAPE(UTF8_ESCAPE_SHELL, "", 0, "''");
+}
+
+#define ASSERT_UNESCAPE(style, in, expected, expected_len)                     \
+  do {                                                                         \
+    clear_buff(buff);                                                          \
+    ASSERT_EQ(utf8_unescape(utf8_reinterpret_string(in), strlen(in), style,    \
+                            buff_ptr),                                         \
+              (ssize_t)(expected_len));                                        \
+    ASSERT_EQ(memcmp(buff, expected, expected_len), 0);                        \
+  } while (0)
+
+UTEST(utf8_unescape, json) {
+  TEST_SETUP();
+  ASSERT_UNESCAPE(UTF8_ESCAPE_JSON, "a\\\"b\\\\c\\n\\/", "a\"b\\c\n/", 7);
+  ASSERT_UNESCAPE(UTF8_ESCAPE_JSON, "\\u03bbx", "\xCE\xBBx", 3);
+  ASSERT_UNESCAPE(UTF8_ESCAPE_JSON, "\\u0000", "\0", 1);
+  // Surrogate pair
+  ASSERT_UNESCAPE(UTF8_ESCAPE_JSON, "\\uD83D\\uDE00!", "\xF0\x9F\x98\x80!", 5);
+
+  // Lone surrogate
+  ASSERT_EQ(utf8_unescape(utf8_reinterpret_string("\\uD83Dx"), 7,
+                          UTF8_ESCAPE_JSON, buff_ptr),
+            (ssize_t)-1);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_UNICODE_CODEPOINT);
+  set_utf8_lib_error(0);
+
+  ASSERT_EQ(utf8_unescape(utf8_reinterpret_string("\\uDE00"), 6,
+                          UTF8_ESCAPE_JSON, buff_ptr),
+            (ssize_t)-1);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_UNICODE_CODEPOINT);
+  set_utf8_lib_error(0);
+
+  ASSERT_EQ(utf8_unescape(utf8_reinterpret_string("ab\\x41"), 6,
+                          UTF8_ESCAPE_JSON, buff_ptr),
+            (ssize_t)-1);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_ESCAPE_SEQUENCE);
+  set_utf8_lib_error(0);
+}
+
+UTEST(utf8_unescape, c_and_shell) {
+  TEST_SETUP();
+  ASSERT_UNESCAPE(UTF8_ESCAPE_C, "\\0011\\177\\x41\\t", "\x01"
+                                                       "1\x7F"
+                                                       "A\t",
+                  5);
+  ASSERT_UNESCAPE(UTF8_ESCAPE_C, "\\u03BB\\U0001F600",
+                  "\xCE\xBB\xF0\x9F\x98\x80", 6);
+  ASSERT_UNESCAPE(UTF8_ESCAPE_SHELL, "'it'\\''s'", "it's", 4);
+
+  ASSERT_EQ(utf8_unescape(utf8_reinterpret_string("\\x100"), 5, UTF8_ESCAPE_C,
+                          buff_ptr),
+            (ssize_t)-1);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_ESCAPE_SEQUENCE);
+  set_utf8_lib_error(0);
+
+  ASSERT_EQ(utf8_unescape(utf8_reinterpret_string("'abc"), 4,
+                          UTF8_ESCAPE_SHELL, buff_ptr),
+            (ssize_t)-1);
+  err = get_utf8_lib_error();
+  ASSERT_EQ(err, INVALID_ESCAPE_SEQUENCE);
+  set_utf8_lib_error(0);
+}
+
+UTEST(utf8_unescape, round_trip) {
+  TEST_SETUP();
+  (void)err;
+  const char *in = "\"Hello\"\n\t\\ w\xC3\xB6rld \x01 it's \xF0\x9F\x98\x80";
+  const enum utf8_escape_style styles[] = {UTF8_ESCAPE_JSON, UTF8_ESCAPE_C,
+                                           UTF8_ESCAPE_SHELL};
+  for (int i = 0; i < 3; i++) {
+    utf8_chr escaped[128];
+    const size_t n = utf8_escape(utf8_reinterpret_string(in), strlen(in),
+                                 styles[i], escaped);
+    ASSERT_EQ(n, utf8_escaped_size(utf8_reinterpret_string(in), strlen(in),
+                                   styles[i]));
+    clear_buff(buff);
+    ASSERT_EQ(utf8_unescape(escaped, n, styles[i], buff_ptr),
+              (ssize_t)strlen(in));
+    ASSERT_STREQ(buff, in);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_span                                               //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_span, make) {
+  struct utf8_span span = utf8_span_from_cstr(utf8_reinterpret_string(""));
+  ASSERT_TRUE(utf8_span_valid(&span));
+  ASSERT_TRUE(utf8_span_is_ascii(&span));
+  ASSERT_EQ(utf8_span_strlen(&span), (size_t)0);
+
+  const char *ascii = "a long line of plain ASCII text, 42 bytes";
+  span = utf8_span_from_cstr(utf8_reinterpret_string(ascii));
+  ASSERT_TRUE(utf8_span_is_ascii(&span));
+  ASSERT_EQ(span.len, strlen(ascii));
+  ASSERT_EQ(utf8_span_strlen(&span), strlen(ascii));
+
+  // The first non-ASCII symbol after a long ASCII prefix.
+  const char *mixed = "a long line of plain ASCII text, then \xC3\xA9\xF0\x9F"
+                      "\x98\x80!";
+  span = utf8_span_from_cstr(utf8_reinterpret_string(mixed));
+  ASSERT_TRUE(utf8_span_valid(&span));
+  ASSERT_FALSE(utf8_span_is_ascii(&span));
+  ASSERT_EQ(utf8_span_strlen(&span), (size_t)41);
+  ASSERT_EQ(utf8_span_strlen(&span), utf8_strlen(span.data));
+
+  set_utf8_lib_error(0);
+  span = utf8_span_make(utf8_reinterpret_string("ab\xC3"), 3);
+  ASSERT_FALSE(utf8_span_valid(&span));
+  ASSERT_FALSE(utf8_span_is_ascii(&span));
+  ASSERT_EQ(get_utf8_lib_error(), 0);
+  ASSERT_EQ(utf8_span_strlen(&span), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+UTEST(utf8_span, offset_and_sub) {
+  // "aé€😀b"
+  const char *text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"
+                     "b";
+  struct utf8_span span = utf8_span_from_cstr(utf8_reinterpret_string(text));
+  const size_t offsets[] = {0, 1, 3, 6, 10, 11, 11};
+  for (size_t n = 0; n < 7; n++)
+    ASSERT_EQ(utf8_span_offset(&span, n), offsets[n]);
+
+  struct utf8_span sub = utf8_span_sub(&span, 1, 2);
+  ASSERT_TRUE(sub.data == span.data + 1);
+  ASSERT_EQ(sub.len, (size_t)5);
+  ASSERT_EQ(sub.count, (size_t)2);
+  ASSERT_FALSE(utf8_span_is_ascii(&sub));
+
+  sub = utf8_span_sub(&span, 4, 100);
+  ASSERT_EQ(sub.len, (size_t)1);
+  ASSERT_TRUE(utf8_span_is_ascii(&sub));
+  sub = utf8_span_sub(&span, 9, 1);
+  ASSERT_EQ(sub.len, (size_t)0);
+  ASSERT_TRUE(sub.data == span.data + span.len);
+
+  struct utf8_span ascii = utf8_span_from_cstr(utf8_reinterpret_string("hey"));
+  sub = utf8_span_sub(&ascii, 1, 5);
+  ASSERT_EQ(sub.len, (size_t)2);
+  ASSERT_EQ(utf8_span_offset(&ascii, 2), (size_t)2);
+
+  set_utf8_lib_error(0);
+  struct utf8_span bad = utf8_span_make(utf8_reinterpret_string("\x80"), 1);
+  ASSERT_EQ(utf8_span_offset(&bad, 0), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  sub = utf8_span_sub(&bad, 0, 1);
+  ASSERT_EQ(sub.len, (size_t)0);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+UTEST(utf8_span, chr) {
+  const char *text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"
+                     "b";
+  struct utf8_span span = utf8_span_from_cstr(utf8_reinterpret_string(text));
+  ASSERT_TRUE(utf8_span_chr(&span, 'b') == span.data + 10);
+  ASSERT_TRUE(utf8_span_chr(&span, 0x20AC) == span.data + 3);
+  ASSERT_TRUE(utf8_span_chr(&span, 0x1F600) == span.data + 6);
+  ASSERT_TRUE(utf8_span_chr(&span, 0xE8) == NULL);
+  ASSERT_TRUE(utf8_span_chr(&span, 'z') == NULL);
+
+  struct utf8_span ascii = utf8_span_from_cstr(utf8_reinterpret_string("hey"));
+  ASSERT_TRUE(utf8_span_chr(&ascii, 0xE9) == NULL);
+  ASSERT_TRUE(utf8_span_chr(&ascii, 'y') == ascii.data + 2);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_valid_batch and utf8_strlen_batch                  //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_batch, mixed) {
+  // More than one group of four non-ASCII strings, with ASCII strings,
+  // invalid ones and empty ones in between.
+  const char *strs[] = {"",
+                        "plain ascii, longer than eight bytes",
+                        "caf\xC3\xA9",
+                        "\xE4\xB8\xAD\xE6\x96\x87 and some ASCII after it",
+                        "cut \xE4\xB8",
+                        "\x80 stray",
+                        "\xF0\x9F\x98\x80",
+                        "\xF8 never valid",
+                        "ok \xD0\x96",
+                        "x"};
+  const size_t n = sizeof(strs) / sizeof(*strs);
+  size_t lens[10], counts[10];
+  bool valid[10];
+  for (size_t i = 0; i < n; i++)
+    lens[i] = strlen(strs[i]);
+
+  set_utf8_lib_error(0);
+  utf8_valid_batch((const utf8_chr *const *)strs, lens, n, valid);
+  ASSERT_EQ(get_utf8_lib_error(), 0);
+  utf8_strlen_batch((const utf8_chr *const *)strs, lens, n, counts);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+
+  for (size_t i = 0; i < n; i++) {
+    const utf8_chr *s = utf8_reinterpret_string(strs[i]);
+    ASSERT_EQ(valid[i], utf8_string_valid(s));
+    if (valid[i])
+      ASSERT_EQ(counts[i], utf8_strlen(s));
+    else
+      ASSERT_EQ(counts[i], SIZE_MAX);
+  }
+  set_utf8_lib_error(0);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_transcode                                          //
+//////////////////////////////////////////////////////////////////////
+
+// Transcode s and compare the result with expected. Returns -1 on error.
+static int transcode(const char *s, size_t len, enum utf8_variant from,
+                     enum utf8_variant to, const char *expected,
+                     size_t expected_len) {
+  utf8_chr dest[128];
+  const ssize_t n =
+      utf8_transcode(utf8_reinterpret_string(s), len, from, to, dest);
+  if (n < 0)
+    return -1;
+  return (size_t)n <= utf8_transcode_bound(len, to) &&
+         (size_t)n == expected_len && memcmp(dest, expected, n) == 0;
+}
+
+UTEST(utf8_transcode, variants) {
+  // "a€😀" followed by U+0000 and "b".
+  const char utf8[] = "a\xE2\x82\xAC\xF0\x9F\x98\x80\0b";
+  const char cesu[] = "a\xE2\x82\xAC\xED\xA0\xBD\xED\xB8\x80\0b";
+  const char modified[] = "a\xE2\x82\xAC\xED\xA0\xBD\xED\xB8\x80\xC0\x80"
+                          "b";
+  const size_t utf8_len = sizeof(utf8) - 1, cesu_len = sizeof(cesu) - 1;
+  const size_t modified_len = sizeof(modified) - 1;
+
+  ASSERT_EQ(transcode(utf8, utf8_len, UTF8_VARIANT_STANDARD,
+                      UTF8_VARIANT_CESU8, cesu, cesu_len),
+            1);
+  ASSERT_EQ(transcode(utf8, utf8_len, UTF8_VARIANT_STANDARD,
+                      UTF8_VARIANT_MODIFIED, modified, modified_len),
+            1);
+  ASSERT_EQ(transcode(cesu, cesu_len, UTF8_VARIANT_CESU8,
+                      UTF8_VARIANT_STANDARD, utf8, utf8_len),
+            1);
+  ASSERT_EQ(transcode(modified, modified_len, UTF8_VARIANT_MODIFIED,
+                      UTF8_VARIANT_STANDARD, utf8, utf8_len),
+            1);
+  ASSERT_EQ(transcode(modified, modified_len, UTF8_VARIANT_MODIFIED,
+                      UTF8_VARIANT_CESU8, cesu, cesu_len),
+            1);
+  ASSERT_EQ(transcode(utf8, utf8_len, UTF8_VARIANT_STANDARD,
+                      UTF8_VARIANT_WTF8, utf8, utf8_len),
+            1);
+}
+
+UTEST(utf8_transcode, lone_surrogates) {
+  // A lone high surrogate (U+D800) between ASCII letters.
+  const char wtf8[] = "a\xED\xA0\x80z";
+  ASSERT_EQ(transcode(wtf8, 5, UTF8_VARIANT_WTF8, UTF8_VARIANT_MODIFIED, wtf8,
+                      5),
+            1);
+  ASSERT_EQ(transcode(wtf8, 5, UTF8_VARIANT_MODIFIED, UTF8_VARIANT_WTF8, wtf8,
+                      5),
+            1);
+
+  set_utf8_lib_error(0);
+  ASSERT_EQ(transcode(wtf8, 5, UTF8_VARIANT_WTF8, UTF8_VARIANT_STANDARD, "", 0),
+            -1);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UNICODE_CODEPOINT);
+  set_utf8_lib_error(0);
+  ASSERT_EQ(
+      transcode(wtf8, 5, UTF8_VARIANT_STANDARD, UTF8_VARIANT_WTF8, "", 0), -1);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+
+  // A pair written as two surrogates is not WTF-8, and a 4-byte symbol is
+  // not CESU-8.
+  ASSERT_EQ(transcode("\xED\xA0\xBD\xED\xB8\x80", 6, UTF8_VARIANT_WTF8,
+                      UTF8_VARIANT_STANDARD, "", 0),
+            -1);
+  ASSERT_EQ(transcode("\xF0\x9F\x98\x80", 4, UTF8_VARIANT_CESU8,
+                      UTF8_VARIANT_STANDARD, "", 0),
+            -1);
+  // Overlong forms are rejected; 0xC0 0x80 only in Modified UTF-8.
+  ASSERT_EQ(transcode("\xC0\x80", 2, UTF8_VARIANT_CESU8,
+                      UTF8_VARIANT_STANDARD, "", 0),
+            -1);
+  ASSERT_EQ(transcode("\xE0\x80\xAF", 3, UTF8_VARIANT_STANDARD,
+                      UTF8_VARIANT_CESU8, "", 0),
+            -1);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+UTEST(utf8_transcode, long_runs) {
+  // Runs longer than 16 bytes with BMP symbols, so the block path is used,
+  // round-tripped through every variant.
+  utf8_chr text[512], cesu[1024], back[1024];
+  size_t len = 0;
+  for (int i = 0; i < 20; i++) {
+    len += utf8_from_codepoint(0x4E00 + i, text + len);
+    memcpy(text + len, "plain ascii text", 16);
+    len += 16;
+    if (i % 5 == 0)
+      len += utf8_from_codepoint(0x1F600 + i, text + len);
+  }
+  const enum utf8_variant variants[] = {UTF8_VARIANT_WTF8, UTF8_VARIANT_CESU8,
+                                        UTF8_VARIANT_MODIFIED};
+  for (int v = 0; v < 3; v++) {
+    const ssize_t n =
+        utf8_transcode(text, len, UTF8_VARIANT_STANDARD, variants[v], cesu);
+    ASSERT_GT(n, (ssize_t)0);
+    ASSERT_EQ(utf8_transcode(cesu, n, variants[v], UTF8_VARIANT_STANDARD,
+                             back),
+              (ssize_t)len);
+    ASSERT_EQ(memcmp(text, back, len), 0);
+  }
+}
+
 UTEST_MAIN()
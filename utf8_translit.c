@@ -0,0 +1,557 @@
+#include "utf8_translit.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+struct translit_entry {
+  // Codepoint without diacritics for UTF8_TRANSLIT_FOLD, 0 to remove it.
+  uint16_t fold;
+  // Position of the ASCII spelling in translit_pool << 3 | its length.
+  uint16_t ascii;
+};
+
+// Generated from the Unicode 14.0 character database. Diacritics are found
+// by canonical decomposition. Letters with strokes, ligatures, the Greek and
+// Cyrillic romanization and punctuation follow hand-written lists.
+static const char translit_pool[] =
+    " !cL\?Y|S(C)a<<(R)o+-23uP.1>>1/41/23/4AAEIDNOxUTHssaeidnythGg"
+    "IJijKkqlL.l.'nNGngOEoerWwZzbDZDzdzLJLjljNJNjnj;VThMXFChPsvmp"
+    "fchpsDjYeYiBZhKhTsShShchYuYazhkhtsshshchyuyadjyeyiSS`\"*....."
+    "%o%oo!!\?\?\?!";
+
+static const struct translit_entry translit_table[] = {
+    {0x00A0, 0x0001}, {0x00A1, 0x0009}, {0x00A2, 0x0011}, {0x00A3, 0x0019},
+    {0x00A4, 0x0021}, {0x00A5, 0x0029}, {0x00A6, 0x0031}, {0x00A7, 0x0039},
+    {0x00A8, 0x0001}, {0x00A9, 0x0043}, {0x00AA, 0x0059}, {0x00AB, 0x0062},
+    {0x00AC, 0x0009}, {0x00AD, 0x0000}, {0x00AE, 0x0073}, {0x00AF, 0x0001},
+    {0x00B0, 0x0089}, {0x00B1, 0x0092}, {0x00B2, 0x00A1}, {0x00B3, 0x00A9},
+    {0x00B4, 0x0001}, {0x00B5, 0x00B1}, {0x00B6, 0x00B9}, {0x00B7, 0x00C1},
+    {0x00B8, 0x0001}, {0x00B9, 0x00C9}, {0x00BA, 0x0089}, {0x00BB, 0x00D2},
+    {0x00BC, 0x00E3}, {0x00BD, 0x00FB}, {0x00BE, 0x0113}, {0x00BF, 0x0021},
+    {0x0041, 0x0129}, {0x0041, 0x0129}, {0x0041, 0x0129}, {0x0041, 0x0129},
+    {0x0041, 0x0129}, {0x0041, 0x0129}, {0x00C6, 0x0132}, {0x0043, 0x0049},
+    {0x0045, 0x0139}, {0x0045, 0x0139}, {0x0045, 0x0139}, {0x0045, 0x0139},
+    {0x0049, 0x0141}, {0x0049, 0x0141}, {0x0049, 0x0141}, {0x0049, 0x0141},
+    {0x00D0, 0x0149}, {0x004E, 0x0151}, {0x004F, 0x0159}, {0x004F, 0x0159},
+    {0x004F, 0x0159}, {0x004F, 0x0159}, {0x004F, 0x0159}, {0x00D7, 0x0161},
+    {0x004F, 0x0159}, {0x0055, 0x0169}, {0x0055, 0x0169}, {0x0055, 0x0169},
+    {0x0055, 0x0169}, {0x0059, 0x0029}, {0x00DE, 0x0172}, {0x00DF, 0x0182},
+    {0x0061, 0x0059}, {0x0061, 0x0059}, {0x0061, 0x0059}, {0x0061, 0x0059},
+    {0x0061, 0x0059}, {0x0061, 0x0059}, {0x00E6, 0x0192}, {0x0063, 0x0011},
+    {0x0065, 0x0199}, {0x0065, 0x0199}, {0x0065, 0x0199}, {0x0065, 0x0199},
+    {0x0069, 0x01A1}, {0x0069, 0x01A1}, {0x0069, 0x01A1}, {0x0069, 0x01A1},
+    {0x00F0, 0x01A9}, {0x006E, 0x01B1}, {0x006F, 0x0089}, {0x006F, 0x0089},
+    {0x006F, 0x0089}, {0x006F, 0x0089}, {0x006F, 0x0089}, {0x00F7, 0x00E9},
+    {0x006F, 0x0089}, {0x0075, 0x00B1}, {0x0075, 0x00B1}, {0x0075, 0x00B1},
+    {0x0075, 0x00B1}, {0x0079, 0x01B9}, {0x00FE, 0x01C2}, {0x0079, 0x01B9},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0043, 0x0049}, {0x0063, 0x0011},
+    {0x0043, 0x0049}, {0x0063, 0x0011}, {0x0043, 0x0049}, {0x0063, 0x0011},
+    {0x0043, 0x0049}, {0x0063, 0x0011}, {0x0044, 0x0149}, {0x0064, 0x01A9},
+    {0x0044, 0x0149}, {0x0064, 0x01A9}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0047, 0x01D1}, {0x0067, 0x01D9}, {0x0047, 0x01D1}, {0x0067, 0x01D9},
+    {0x0047, 0x01D1}, {0x0067, 0x01D9}, {0x0047, 0x01D1}, {0x0067, 0x01D9},
+    {0x0048, 0x0179}, {0x0068, 0x01C9}, {0x0048, 0x0179}, {0x0068, 0x01C9},
+    {0x0049, 0x0141}, {0x0069, 0x01A1}, {0x0049, 0x0141}, {0x0069, 0x01A1},
+    {0x0049, 0x0141}, {0x0069, 0x01A1}, {0x0049, 0x0141}, {0x0069, 0x01A1},
+    {0x0049, 0x0141}, {0x0131, 0x01A1}, {0x0132, 0x01E2}, {0x0133, 0x01F2},
+    {0x004A, 0x01E9}, {0x006A, 0x01F9}, {0x004B, 0x0201}, {0x006B, 0x0209},
+    {0x0138, 0x0211}, {0x004C, 0x0019}, {0x006C, 0x0219}, {0x004C, 0x0019},
+    {0x006C, 0x0219}, {0x004C, 0x0019}, {0x006C, 0x0219}, {0x013F, 0x0222},
+    {0x0140, 0x0232}, {0x004C, 0x0019}, {0x006C, 0x0219}, {0x004E, 0x0151},
+    {0x006E, 0x01B1}, {0x004E, 0x0151}, {0x006E, 0x01B1}, {0x004E, 0x0151},
+    {0x006E, 0x01B1}, {0x0149, 0x0242}, {0x014A, 0x0252}, {0x014B, 0x0262},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x0152, 0x0272}, {0x0153, 0x0282},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0052, 0x0079}, {0x0072, 0x0291},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0053, 0x0039}, {0x0073, 0x0181},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0053, 0x0039}, {0x0073, 0x0181},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0054, 0x0171}, {0x0074, 0x01C1},
+    {0x0054, 0x0171}, {0x0074, 0x01C1}, {0x0054, 0x0171}, {0x0074, 0x01C1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0057, 0x0299}, {0x0077, 0x02A1}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x0059, 0x0029}, {0x005A, 0x02A9}, {0x007A, 0x02B1}, {0x005A, 0x02A9},
+    {0x007A, 0x02B1}, {0x005A, 0x02A9}, {0x007A, 0x02B1}, {0x017F, 0x0181},
+    {0x0062, 0x02B9}, {0x0181, 0x0021}, {0x0182, 0x0021}, {0x0183, 0x0021},
+    {0x0184, 0x0021}, {0x0185, 0x0021}, {0x0186, 0x0021}, {0x0187, 0x0021},
+    {0x0188, 0x0021}, {0x0189, 0x0021}, {0x018A, 0x0021}, {0x018B, 0x0021},
+    {0x018C, 0x0021}, {0x018D, 0x0021}, {0x018E, 0x0021}, {0x018F, 0x0139},
+    {0x0190, 0x0021}, {0x0191, 0x0021}, {0x0192, 0x0021}, {0x0193, 0x0021},
+    {0x0194, 0x0021}, {0x0195, 0x0021}, {0x0196, 0x0021}, {0x0049, 0x0141},
+    {0x0198, 0x0021}, {0x0199, 0x0021}, {0x019A, 0x0021}, {0x019B, 0x0021},
+    {0x019C, 0x0021}, {0x019D, 0x0021}, {0x019E, 0x0021}, {0x019F, 0x0021},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x01A2, 0x0021}, {0x01A3, 0x0021},
+    {0x01A4, 0x0021}, {0x01A5, 0x0021}, {0x01A6, 0x0021}, {0x01A7, 0x0021},
+    {0x01A8, 0x0021}, {0x01A9, 0x0021}, {0x01AA, 0x0021}, {0x01AB, 0x0021},
+    {0x01AC, 0x0021}, {0x01AD, 0x0021}, {0x01AE, 0x0021}, {0x0055, 0x0169},
+    {0x0075, 0x00B1}, {0x01B1, 0x0021}, {0x01B2, 0x0021}, {0x01B3, 0x0021},
+    {0x01B4, 0x0021}, {0x005A, 0x02A9}, {0x007A, 0x02B1}, {0x01B7, 0x02A9},
+    {0x01B8, 0x0021}, {0x01B9, 0x0021}, {0x01BA, 0x0021}, {0x01BB, 0x0021},
+    {0x01BC, 0x0021}, {0x01BD, 0x0021}, {0x01BE, 0x0021}, {0x01BF, 0x0021},
+    {0x01C0, 0x0021}, {0x01C1, 0x0021}, {0x01C2, 0x0021}, {0x01C3, 0x0021},
+    {0x01C4, 0x02C2}, {0x01C5, 0x02D2}, {0x01C6, 0x02E2}, {0x01C7, 0x02F2},
+    {0x01C8, 0x0302}, {0x01C9, 0x0312}, {0x01CA, 0x0322}, {0x01CB, 0x0332},
+    {0x01CC, 0x0342}, {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0049, 0x0141},
+    {0x0069, 0x01A1}, {0x004F, 0x0159}, {0x006F, 0x0089}, {0x0055, 0x0169},
+    {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169},
+    {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169},
+    {0x0075, 0x00B1}, {0x01DD, 0x0199}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x00C6, 0x0132}, {0x00E6, 0x0192},
+    {0x0047, 0x01D1}, {0x0067, 0x01D9}, {0x0047, 0x01D1}, {0x0067, 0x01D9},
+    {0x004B, 0x0201}, {0x006B, 0x0209}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x01B7, 0x02A9}, {0x0292, 0x02B1},
+    {0x006A, 0x01F9}, {0x01F1, 0x02C2}, {0x01F2, 0x02D2}, {0x01F3, 0x02E2},
+    {0x0047, 0x01D1}, {0x0067, 0x01D9}, {0x01F6, 0x0021}, {0x01F7, 0x0021},
+    {0x004E, 0x0151}, {0x006E, 0x01B1}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x00C6, 0x0132}, {0x00E6, 0x0192}, {0x00D8, 0x0021}, {0x00F8, 0x0021},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0049, 0x0141}, {0x0069, 0x01A1}, {0x0049, 0x0141}, {0x0069, 0x01A1},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0052, 0x0079}, {0x0072, 0x0291},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0054, 0x0171}, {0x0074, 0x01C1},
+    {0x021C, 0x0021}, {0x021D, 0x0021}, {0x0048, 0x0179}, {0x0068, 0x01C9},
+    {0x0220, 0x0021}, {0x0221, 0x0021}, {0x0222, 0x0021}, {0x0223, 0x0021},
+    {0x0224, 0x0021}, {0x0225, 0x0021}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x0234, 0x0021}, {0x0235, 0x0021}, {0x0236, 0x0021}, {0x0237, 0x0021},
+    {0x0238, 0x0021}, {0x0239, 0x0021}, {0x0041, 0x0129}, {0x023B, 0x0021},
+    {0x023C, 0x0021}, {0x023D, 0x0021}, {0x0054, 0x0171}, {0x023F, 0x0021},
+    {0x0240, 0x0021}, {0x0241, 0x0021}, {0x0242, 0x0021}, {0x0243, 0x0021},
+    {0x0244, 0x0021}, {0x0245, 0x0021}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x004A, 0x01E9}, {0x006A, 0x01F9}, {0x024A, 0x0021}, {0x024B, 0x0021},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x0250, 0x0021}, {0x0251, 0x0021}, {0x0252, 0x0021}, {0x0253, 0x0021},
+    {0x0254, 0x0021}, {0x0255, 0x0021}, {0x0256, 0x0021}, {0x0257, 0x0021},
+    {0x0258, 0x0021}, {0x0259, 0x0199}, {0x025A, 0x0021}, {0x025B, 0x0021},
+    {0x025C, 0x0021}, {0x025D, 0x0021}, {0x025E, 0x0021}, {0x025F, 0x0021},
+    {0x0260, 0x0021}, {0x0261, 0x0021}, {0x0262, 0x0021}, {0x0263, 0x0021},
+    {0x0264, 0x0021}, {0x0265, 0x0021}, {0x0266, 0x0021}, {0x0267, 0x0021},
+    {0x0069, 0x01A1}, {0x0269, 0x0021}, {0x026A, 0x0021}, {0x026B, 0x0021},
+    {0x026C, 0x0021}, {0x026D, 0x0021}, {0x026E, 0x0021}, {0x026F, 0x0021},
+    {0x0270, 0x0021}, {0x0271, 0x0021}, {0x0272, 0x0021}, {0x0273, 0x0021},
+    {0x0274, 0x0021}, {0x0275, 0x0021}, {0x0276, 0x0021}, {0x0277, 0x0021},
+    {0x0278, 0x0021}, {0x0279, 0x0021}, {0x027A, 0x0021}, {0x027B, 0x0021},
+    {0x027C, 0x0021}, {0x027D, 0x0021}, {0x027E, 0x0021}, {0x027F, 0x0021},
+    {0x0280, 0x0021}, {0x0281, 0x0021}, {0x0282, 0x0021}, {0x0283, 0x0021},
+    {0x0284, 0x0021}, {0x0285, 0x0021}, {0x0286, 0x0021}, {0x0287, 0x0021},
+    {0x0288, 0x0021}, {0x0289, 0x0021}, {0x028A, 0x0021}, {0x028B, 0x0021},
+    {0x028C, 0x0021}, {0x028D, 0x0021}, {0x028E, 0x0021}, {0x028F, 0x0021},
+    {0x0290, 0x0021}, {0x0291, 0x0021}, {0x0292, 0x02B1}, {0x0293, 0x0021},
+    {0x0294, 0x0021}, {0x0295, 0x0021}, {0x0296, 0x0021}, {0x0297, 0x0021},
+    {0x0298, 0x0021}, {0x0299, 0x0021}, {0x029A, 0x0021}, {0x029B, 0x0021},
+    {0x029C, 0x0021}, {0x029D, 0x0021}, {0x029E, 0x0021}, {0x029F, 0x0021},
+    {0x02A0, 0x0021}, {0x02A1, 0x0021}, {0x02A2, 0x0021}, {0x02A3, 0x0021},
+    {0x02A4, 0x0021}, {0x02A5, 0x0021}, {0x02A6, 0x0021}, {0x02A7, 0x0021},
+    {0x02A8, 0x0021}, {0x02A9, 0x0021}, {0x02AA, 0x0021}, {0x02AB, 0x0021},
+    {0x02AC, 0x0021}, {0x02AD, 0x0021}, {0x02AE, 0x0021}, {0x02AF, 0x0021},
+    {0x02B0, 0x01C9}, {0x02B1, 0x0021}, {0x02B2, 0x01F9}, {0x02B3, 0x0291},
+    {0x02B4, 0x0021}, {0x02B5, 0x0021}, {0x02B6, 0x0021}, {0x02B7, 0x02A1},
+    {0x02B8, 0x01B9}, {0x02B9, 0x0021}, {0x02BA, 0x0021}, {0x02BB, 0x0021},
+    {0x02BC, 0x0021}, {0x02BD, 0x0021}, {0x02BE, 0x0021}, {0x02BF, 0x0021},
+    {0x02C0, 0x0021}, {0x02C1, 0x0021}, {0x02C2, 0x0021}, {0x02C3, 0x0021},
+    {0x02C4, 0x0021}, {0x02C5, 0x0021}, {0x02C6, 0x0021}, {0x02C7, 0x0021},
+    {0x02C8, 0x0021}, {0x02C9, 0x0021}, {0x02CA, 0x0021}, {0x02CB, 0x0021},
+    {0x02CC, 0x0021}, {0x02CD, 0x0021}, {0x02CE, 0x0021}, {0x02CF, 0x0021},
+    {0x02D0, 0x0021}, {0x02D1, 0x0021}, {0x02D2, 0x0021}, {0x02D3, 0x0021},
+    {0x02D4, 0x0021}, {0x02D5, 0x0021}, {0x02D6, 0x0021}, {0x02D7, 0x0021},
+    {0x02D8, 0x0001}, {0x02D9, 0x0001}, {0x02DA, 0x0001}, {0x02DB, 0x0001},
+    {0x02DC, 0x0001}, {0x02DD, 0x0001}, {0x02DE, 0x0021}, {0x02DF, 0x0021},
+    {0x02E0, 0x0021}, {0x02E1, 0x0219}, {0x02E2, 0x0181}, {0x02E3, 0x0161},
+    {0x02E4, 0x0021}, {0x02E5, 0x0021}, {0x02E6, 0x0021}, {0x02E7, 0x0021},
+    {0x02E8, 0x0021}, {0x02E9, 0x0021}, {0x02EA, 0x0021}, {0x02EB, 0x0021},
+    {0x02EC, 0x0021}, {0x02ED, 0x0021}, {0x02EE, 0x0021}, {0x02EF, 0x0021},
+    {0x02F0, 0x0021}, {0x02F1, 0x0021}, {0x02F2, 0x0021}, {0x02F3, 0x0021},
+    {0x02F4, 0x0021}, {0x02F5, 0x0021}, {0x02F6, 0x0021}, {0x02F7, 0x0021},
+    {0x02F8, 0x0021}, {0x02F9, 0x0021}, {0x02FA, 0x0021}, {0x02FB, 0x0021},
+    {0x02FC, 0x0021}, {0x02FD, 0x0021}, {0x02FE, 0x0021}, {0x02FF, 0x0021},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0370, 0x0021}, {0x0371, 0x0021}, {0x0372, 0x0021}, {0x0373, 0x0021},
+    {0x02B9, 0x0021}, {0x0375, 0x0021}, {0x0376, 0x0021}, {0x0377, 0x0021},
+    {0x0378, 0x0021}, {0x0379, 0x0021}, {0x037A, 0x0001}, {0x037B, 0x0021},
+    {0x037C, 0x0021}, {0x037D, 0x0021}, {0x003B, 0x0351}, {0x037F, 0x0021},
+    {0x0380, 0x0021}, {0x0381, 0x0021}, {0x0382, 0x0021}, {0x0383, 0x0021},
+    {0x0384, 0x0001}, {0x00A8, 0x0001}, {0x0391, 0x0129}, {0x00B7, 0x00C1},
+    {0x0395, 0x0139}, {0x0397, 0x0141}, {0x0399, 0x0141}, {0x038B, 0x0021},
+    {0x039F, 0x0159}, {0x038D, 0x0021}, {0x03A5, 0x0029}, {0x03A9, 0x0159},
+    {0x03B9, 0x01A1}, {0x0391, 0x0129}, {0x0392, 0x0359}, {0x0393, 0x01D1},
+    {0x0394, 0x0149}, {0x0395, 0x0139}, {0x0396, 0x02A9}, {0x0397, 0x0141},
+    {0x0398, 0x0362}, {0x0399, 0x0141}, {0x039A, 0x0201}, {0x039B, 0x0019},
+    {0x039C, 0x0371}, {0x039D, 0x0151}, {0x039E, 0x0379}, {0x039F, 0x0159},
+    {0x03A0, 0x00B9}, {0x03A1, 0x0079}, {0x03A2, 0x0021}, {0x03A3, 0x0039},
+    {0x03A4, 0x0171}, {0x03A5, 0x0029}, {0x03A6, 0x0381}, {0x03A7, 0x038A},
+    {0x03A8, 0x039A}, {0x03A9, 0x0159}, {0x0399, 0x0141}, {0x03A5, 0x0029},
+    {0x03B1, 0x0059}, {0x03B5, 0x0199}, {0x03B7, 0x01A1}, {0x03B9, 0x01A1},
+    {0x03C5, 0x01B9}, {0x03B1, 0x0059}, {0x03B2, 0x03A9}, {0x03B3, 0x01D9},
+    {0x03B4, 0x01A9}, {0x03B5, 0x0199}, {0x03B6, 0x02B1}, {0x03B7, 0x01A1},
+    {0x03B8, 0x01C2}, {0x03B9, 0x01A1}, {0x03BA, 0x0209}, {0x03BB, 0x0219},
+    {0x03BC, 0x03B1}, {0x03BD, 0x01B1}, {0x03BE, 0x0161}, {0x03BF, 0x0089},
+    {0x03C0, 0x03B9}, {0x03C1, 0x0291}, {0x03C2, 0x0181}, {0x03C3, 0x0181},
+    {0x03C4, 0x01C1}, {0x03C5, 0x01B9}, {0x03C6, 0x03C1}, {0x03C7, 0x03CA},
+    {0x03C8, 0x03DA}, {0x03C9, 0x0089}, {0x03B9, 0x01A1}, {0x03C5, 0x01B9},
+    {0x03BF, 0x0089}, {0x03C5, 0x01B9}, {0x03C9, 0x0089}, {0x03CF, 0x0021},
+    {0x03D0, 0x0021}, {0x03D1, 0x0021}, {0x03D2, 0x0021}, {0x03D2, 0x0021},
+    {0x03D2, 0x0021}, {0x03D5, 0x0021}, {0x03D6, 0x0021}, {0x03D7, 0x0021},
+    {0x03D8, 0x0021}, {0x03D9, 0x0021}, {0x03DA, 0x0021}, {0x03DB, 0x0021},
+    {0x03DC, 0x0021}, {0x03DD, 0x0021}, {0x03DE, 0x0021}, {0x03DF, 0x0021},
+    {0x03E0, 0x0021}, {0x03E1, 0x0021}, {0x03E2, 0x0021}, {0x03E3, 0x0021},
+    {0x03E4, 0x0021}, {0x03E5, 0x0021}, {0x03E6, 0x0021}, {0x03E7, 0x0021},
+    {0x03E8, 0x0021}, {0x03E9, 0x0021}, {0x03EA, 0x0021}, {0x03EB, 0x0021},
+    {0x03EC, 0x0021}, {0x03ED, 0x0021}, {0x03EE, 0x0021}, {0x03EF, 0x0021},
+    {0x03F0, 0x0021}, {0x03F1, 0x0021}, {0x03F2, 0x0021}, {0x03F3, 0x0021},
+    {0x03F4, 0x0362}, {0x03F5, 0x0021}, {0x03F6, 0x0021}, {0x03F7, 0x0021},
+    {0x03F8, 0x0021}, {0x03F9, 0x0021}, {0x03FA, 0x0021}, {0x03FB, 0x0021},
+    {0x03FC, 0x0021}, {0x03FD, 0x0021}, {0x03FE, 0x0021}, {0x03FF, 0x0021},
+    {0x0415, 0x0139}, {0x0415, 0x0139}, {0x0402, 0x03EA}, {0x0413, 0x01D1},
+    {0x0404, 0x03FA}, {0x0405, 0x02D2}, {0x0406, 0x0141}, {0x0406, 0x040A},
+    {0x0408, 0x01E9}, {0x0409, 0x0302}, {0x040A, 0x0332}, {0x040B, 0x0049},
+    {0x041A, 0x0201}, {0x0418, 0x0141}, {0x0423, 0x0169}, {0x040F, 0x02D2},
+    {0x0410, 0x0129}, {0x0411, 0x0419}, {0x0412, 0x0359}, {0x0413, 0x01D1},
+    {0x0414, 0x0149}, {0x0415, 0x0139}, {0x0416, 0x0422}, {0x0417, 0x02A9},
+    {0x0418, 0x0141}, {0x0418, 0x0029}, {0x041A, 0x0201}, {0x041B, 0x0019},
+    {0x041C, 0x0371}, {0x041D, 0x0151}, {0x041E, 0x0159}, {0x041F, 0x00B9},
+    {0x0420, 0x0079}, {0x0421, 0x0039}, {0x0422, 0x0171}, {0x0423, 0x0169},
+    {0x0424, 0x0381}, {0x0425, 0x0432}, {0x0426, 0x0442}, {0x0427, 0x038A},
+    {0x0428, 0x0452}, {0x0429, 0x0464}, {0x042A, 0x0000}, {0x042B, 0x0029},
+    {0x042C, 0x0000}, {0x042D, 0x0139}, {0x042E, 0x0482}, {0x042F, 0x0492},
+    {0x0430, 0x0059}, {0x0431, 0x02B9}, {0x0432, 0x03A9}, {0x0433, 0x01D9},
+    {0x0434, 0x01A9}, {0x0435, 0x0199}, {0x0436, 0x04A2}, {0x0437, 0x02B1},
+    {0x0438, 0x01A1}, {0x0438, 0x01B9}, {0x043A, 0x0209}, {0x043B, 0x0219},
+    {0x043C, 0x03B1}, {0x043D, 0x01B1}, {0x043E, 0x0089}, {0x043F, 0x03B9},
+    {0x0440, 0x0291}, {0x0441, 0x0181}, {0x0442, 0x01C1}, {0x0443, 0x00B1},
+    {0x0444, 0x03C1}, {0x0445, 0x04B2}, {0x0446, 0x04C2}, {0x0447, 0x03CA},
+    {0x0448, 0x04D2}, {0x0449, 0x04E4}, {0x044A, 0x0000}, {0x044B, 0x01B9},
+    {0x044C, 0x0000}, {0x044D, 0x0199}, {0x044E, 0x0502}, {0x044F, 0x0512},
+    {0x0435, 0x0199}, {0x0435, 0x0199}, {0x0452, 0x0522}, {0x0433, 0x01D9},
+    {0x0454, 0x0532}, {0x0455, 0x02E2}, {0x0456, 0x01A1}, {0x0456, 0x0542},
+    {0x0458, 0x01F9}, {0x0459, 0x0312}, {0x045A, 0x0342}, {0x045B, 0x0011},
+    {0x043A, 0x0209}, {0x0438, 0x01A1}, {0x0443, 0x00B1}, {0x045F, 0x02E2},
+    {0x0460, 0x0021}, {0x0461, 0x0021}, {0x0462, 0x0021}, {0x0463, 0x0021},
+    {0x0464, 0x0021}, {0x0465, 0x0021}, {0x0466, 0x0021}, {0x0467, 0x0021},
+    {0x0468, 0x0021}, {0x0469, 0x0021}, {0x046A, 0x0021}, {0x046B, 0x0021},
+    {0x046C, 0x0021}, {0x046D, 0x0021}, {0x046E, 0x0021}, {0x046F, 0x0021},
+    {0x0470, 0x0021}, {0x0471, 0x0021}, {0x0472, 0x0021}, {0x0473, 0x0021},
+    {0x0474, 0x0021}, {0x0475, 0x0021}, {0x0474, 0x0021}, {0x0475, 0x0021},
+    {0x0478, 0x0021}, {0x0479, 0x0021}, {0x047A, 0x0021}, {0x047B, 0x0021},
+    {0x047C, 0x0021}, {0x047D, 0x0021}, {0x047E, 0x0021}, {0x047F, 0x0021},
+    {0x0480, 0x0021}, {0x0481, 0x0021}, {0x0482, 0x0021}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x048A, 0x0021}, {0x048B, 0x0021},
+    {0x048C, 0x0021}, {0x048D, 0x0021}, {0x048E, 0x0021}, {0x048F, 0x0021},
+    {0x0490, 0x01D1}, {0x0491, 0x01D9}, {0x0492, 0x0021}, {0x0493, 0x0021},
+    {0x0494, 0x0021}, {0x0495, 0x0021}, {0x0496, 0x0021}, {0x0497, 0x0021},
+    {0x0498, 0x0021}, {0x0499, 0x0021}, {0x049A, 0x0021}, {0x049B, 0x0021},
+    {0x049C, 0x0021}, {0x049D, 0x0021}, {0x049E, 0x0021}, {0x049F, 0x0021},
+    {0x04A0, 0x0021}, {0x04A1, 0x0021}, {0x04A2, 0x0021}, {0x04A3, 0x0021},
+    {0x04A4, 0x0021}, {0x04A5, 0x0021}, {0x04A6, 0x0021}, {0x04A7, 0x0021},
+    {0x04A8, 0x0021}, {0x04A9, 0x0021}, {0x04AA, 0x0021}, {0x04AB, 0x0021},
+    {0x04AC, 0x0021}, {0x04AD, 0x0021}, {0x04AE, 0x0021}, {0x04AF, 0x0021},
+    {0x04B0, 0x0021}, {0x04B1, 0x0021}, {0x04B2, 0x0021}, {0x04B3, 0x0021},
+    {0x04B4, 0x0021}, {0x04B5, 0x0021}, {0x04B6, 0x0021}, {0x04B7, 0x0021},
+    {0x04B8, 0x0021}, {0x04B9, 0x0021}, {0x04BA, 0x0021}, {0x04BB, 0x0021},
+    {0x04BC, 0x0021}, {0x04BD, 0x0021}, {0x04BE, 0x0021}, {0x04BF, 0x0021},
+    {0x04C0, 0x0021}, {0x0416, 0x0422}, {0x0436, 0x04A2}, {0x04C3, 0x0021},
+    {0x04C4, 0x0021}, {0x04C5, 0x0021}, {0x04C6, 0x0021}, {0x04C7, 0x0021},
+    {0x04C8, 0x0021}, {0x04C9, 0x0021}, {0x04CA, 0x0021}, {0x04CB, 0x0021},
+    {0x04CC, 0x0021}, {0x04CD, 0x0021}, {0x04CE, 0x0021}, {0x04CF, 0x0021},
+    {0x0410, 0x0129}, {0x0430, 0x0059}, {0x0410, 0x0129}, {0x0430, 0x0059},
+    {0x04D4, 0x0021}, {0x04D5, 0x0021}, {0x0415, 0x0139}, {0x0435, 0x0199},
+    {0x04D8, 0x0021}, {0x04D9, 0x0021}, {0x04D8, 0x0021}, {0x04D9, 0x0021},
+    {0x0416, 0x0422}, {0x0436, 0x04A2}, {0x0417, 0x02A9}, {0x0437, 0x02B1},
+    {0x04E0, 0x0021}, {0x04E1, 0x0021}, {0x0418, 0x0141}, {0x0438, 0x01A1},
+    {0x0418, 0x0141}, {0x0438, 0x01A1}, {0x041E, 0x0159}, {0x043E, 0x0089},
+    {0x04E8, 0x0021}, {0x04E9, 0x0021}, {0x04E8, 0x0021}, {0x04E9, 0x0021},
+    {0x042D, 0x0139}, {0x044D, 0x0199}, {0x0423, 0x0169}, {0x0443, 0x00B1},
+    {0x0423, 0x0169}, {0x0443, 0x00B1}, {0x0423, 0x0169}, {0x0443, 0x00B1},
+    {0x0427, 0x038A}, {0x0447, 0x03CA}, {0x04F6, 0x0021}, {0x04F7, 0x0021},
+    {0x042B, 0x0029}, {0x044B, 0x01B9}, {0x04FA, 0x0021}, {0x04FB, 0x0021},
+    {0x04FC, 0x0021}, {0x04FD, 0x0021}, {0x04FE, 0x0021}, {0x04FF, 0x0021},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000}, {0x0000, 0x0000},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0042, 0x0419}, {0x0062, 0x02B9},
+    {0x0042, 0x0419}, {0x0062, 0x02B9}, {0x0042, 0x0419}, {0x0062, 0x02B9},
+    {0x0043, 0x0049}, {0x0063, 0x0011}, {0x0044, 0x0149}, {0x0064, 0x01A9},
+    {0x0044, 0x0149}, {0x0064, 0x01A9}, {0x0044, 0x0149}, {0x0064, 0x01A9},
+    {0x0044, 0x0149}, {0x0064, 0x01A9}, {0x0044, 0x0149}, {0x0064, 0x01A9},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0046, 0x0381}, {0x0066, 0x03C1},
+    {0x0047, 0x01D1}, {0x0067, 0x01D9}, {0x0048, 0x0179}, {0x0068, 0x01C9},
+    {0x0048, 0x0179}, {0x0068, 0x01C9}, {0x0048, 0x0179}, {0x0068, 0x01C9},
+    {0x0048, 0x0179}, {0x0068, 0x01C9}, {0x0048, 0x0179}, {0x0068, 0x01C9},
+    {0x0049, 0x0141}, {0x0069, 0x01A1}, {0x0049, 0x0141}, {0x0069, 0x01A1},
+    {0x004B, 0x0201}, {0x006B, 0x0209}, {0x004B, 0x0201}, {0x006B, 0x0209},
+    {0x004B, 0x0201}, {0x006B, 0x0209}, {0x004C, 0x0019}, {0x006C, 0x0219},
+    {0x004C, 0x0019}, {0x006C, 0x0219}, {0x004C, 0x0019}, {0x006C, 0x0219},
+    {0x004C, 0x0019}, {0x006C, 0x0219}, {0x004D, 0x0371}, {0x006D, 0x03B1},
+    {0x004D, 0x0371}, {0x006D, 0x03B1}, {0x004D, 0x0371}, {0x006D, 0x03B1},
+    {0x004E, 0x0151}, {0x006E, 0x01B1}, {0x004E, 0x0151}, {0x006E, 0x01B1},
+    {0x004E, 0x0151}, {0x006E, 0x01B1}, {0x004E, 0x0151}, {0x006E, 0x01B1},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x0050, 0x00B9}, {0x0070, 0x03B9}, {0x0050, 0x00B9}, {0x0070, 0x03B9},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0052, 0x0079}, {0x0072, 0x0291},
+    {0x0052, 0x0079}, {0x0072, 0x0291}, {0x0052, 0x0079}, {0x0072, 0x0291},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0053, 0x0039}, {0x0073, 0x0181},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0053, 0x0039}, {0x0073, 0x0181},
+    {0x0053, 0x0039}, {0x0073, 0x0181}, {0x0054, 0x0171}, {0x0074, 0x01C1},
+    {0x0054, 0x0171}, {0x0074, 0x01C1}, {0x0054, 0x0171}, {0x0074, 0x01C1},
+    {0x0054, 0x0171}, {0x0074, 0x01C1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0056, 0x0359}, {0x0076, 0x03A9}, {0x0056, 0x0359}, {0x0076, 0x03A9},
+    {0x0057, 0x0299}, {0x0077, 0x02A1}, {0x0057, 0x0299}, {0x0077, 0x02A1},
+    {0x0057, 0x0299}, {0x0077, 0x02A1}, {0x0057, 0x0299}, {0x0077, 0x02A1},
+    {0x0057, 0x0299}, {0x0077, 0x02A1}, {0x0058, 0x0379}, {0x0078, 0x0161},
+    {0x0058, 0x0379}, {0x0078, 0x0161}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x005A, 0x02A9}, {0x007A, 0x02B1}, {0x005A, 0x02A9}, {0x007A, 0x02B1},
+    {0x005A, 0x02A9}, {0x007A, 0x02B1}, {0x0068, 0x01C9}, {0x0074, 0x01C1},
+    {0x0077, 0x02A1}, {0x0079, 0x01B9}, {0x1E9A, 0x0021}, {0x017F, 0x0181},
+    {0x1E9C, 0x0021}, {0x1E9D, 0x0021}, {0x1E9E, 0x0552}, {0x1E9F, 0x0021},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0041, 0x0129}, {0x0061, 0x0059}, {0x0041, 0x0129}, {0x0061, 0x0059},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0045, 0x0139}, {0x0065, 0x0199}, {0x0045, 0x0139}, {0x0065, 0x0199},
+    {0x0049, 0x0141}, {0x0069, 0x01A1}, {0x0049, 0x0141}, {0x0069, 0x01A1},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x004F, 0x0159}, {0x006F, 0x0089}, {0x004F, 0x0159}, {0x006F, 0x0089},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0055, 0x0169}, {0x0075, 0x00B1},
+    {0x0055, 0x0169}, {0x0075, 0x00B1}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x0059, 0x0029}, {0x0079, 0x01B9}, {0x0059, 0x0029}, {0x0079, 0x01B9},
+    {0x0059, 0x0029}, {0x0079, 0x01B9}, {0x1EFA, 0x0021}, {0x1EFB, 0x0021},
+    {0x1EFC, 0x0021}, {0x1EFD, 0x0021}, {0x1EFE, 0x0021}, {0x1EFF, 0x0021},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129},
+    {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129},
+    {0x03B5, 0x0199}, {0x03B5, 0x0199}, {0x03B5, 0x0199}, {0x03B5, 0x0199},
+    {0x03B5, 0x0199}, {0x03B5, 0x0199}, {0x1F16, 0x0021}, {0x1F17, 0x0021},
+    {0x0395, 0x0139}, {0x0395, 0x0139}, {0x0395, 0x0139}, {0x0395, 0x0139},
+    {0x0395, 0x0139}, {0x0395, 0x0139}, {0x1F1E, 0x0021}, {0x1F1F, 0x0021},
+    {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141},
+    {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141},
+    {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1},
+    {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1},
+    {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141},
+    {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141},
+    {0x03BF, 0x0089}, {0x03BF, 0x0089}, {0x03BF, 0x0089}, {0x03BF, 0x0089},
+    {0x03BF, 0x0089}, {0x03BF, 0x0089}, {0x1F46, 0x0021}, {0x1F47, 0x0021},
+    {0x039F, 0x0159}, {0x039F, 0x0159}, {0x039F, 0x0159}, {0x039F, 0x0159},
+    {0x039F, 0x0159}, {0x039F, 0x0159}, {0x1F4E, 0x0021}, {0x1F4F, 0x0021},
+    {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9},
+    {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9},
+    {0x1F58, 0x0021}, {0x03A5, 0x0029}, {0x1F5A, 0x0021}, {0x03A5, 0x0029},
+    {0x1F5C, 0x0021}, {0x03A5, 0x0029}, {0x1F5E, 0x0021}, {0x03A5, 0x0029},
+    {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159},
+    {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B5, 0x0199}, {0x03B5, 0x0199},
+    {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1},
+    {0x03BF, 0x0089}, {0x03BF, 0x0089}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9},
+    {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x1F7E, 0x0021}, {0x1F7F, 0x0021},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129},
+    {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129},
+    {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141},
+    {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141}, {0x0397, 0x0141},
+    {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159},
+    {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159},
+    {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x03B1, 0x0059}, {0x1FB5, 0x0021}, {0x03B1, 0x0059}, {0x03B1, 0x0059},
+    {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129}, {0x0391, 0x0129},
+    {0x0391, 0x0129}, {0x1FBD, 0x0001}, {0x03B9, 0x01A1}, {0x1FBF, 0x0001},
+    {0x1FC0, 0x0001}, {0x00A8, 0x0001}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x03B7, 0x01A1}, {0x1FC5, 0x0021}, {0x03B7, 0x01A1}, {0x03B7, 0x01A1},
+    {0x0395, 0x0139}, {0x0395, 0x0139}, {0x0397, 0x0141}, {0x0397, 0x0141},
+    {0x0397, 0x0141}, {0x1FBF, 0x0001}, {0x1FBF, 0x0001}, {0x1FBF, 0x0001},
+    {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1},
+    {0x1FD4, 0x0021}, {0x1FD5, 0x0021}, {0x03B9, 0x01A1}, {0x03B9, 0x01A1},
+    {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141}, {0x0399, 0x0141},
+    {0x1FDC, 0x0021}, {0x1FFE, 0x0001}, {0x1FFE, 0x0001}, {0x1FFE, 0x0001},
+    {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9},
+    {0x03C1, 0x0291}, {0x03C1, 0x0291}, {0x03C5, 0x01B9}, {0x03C5, 0x01B9},
+    {0x03A5, 0x0029}, {0x03A5, 0x0029}, {0x03A5, 0x0029}, {0x03A5, 0x0029},
+    {0x03A1, 0x0079}, {0x00A8, 0x0001}, {0x00A8, 0x0001}, {0x0060, 0x0561},
+    {0x1FF0, 0x0021}, {0x1FF1, 0x0021}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x03C9, 0x0089}, {0x1FF5, 0x0021}, {0x03C9, 0x0089}, {0x03C9, 0x0089},
+    {0x039F, 0x0159}, {0x039F, 0x0159}, {0x03A9, 0x0159}, {0x03A9, 0x0159},
+    {0x03A9, 0x0159}, {0x00B4, 0x0001}, {0x1FFE, 0x0001}, {0x1FFF, 0x0021},
+    {0x2002, 0x0001}, {0x2003, 0x0001}, {0x2002, 0x0001}, {0x2003, 0x0001},
+    {0x2004, 0x0001}, {0x2005, 0x0001}, {0x2006, 0x0001}, {0x2007, 0x0001},
+    {0x2008, 0x0001}, {0x2009, 0x0001}, {0x200A, 0x0001}, {0x200B, 0x0000},
+    {0x200C, 0x0000}, {0x200D, 0x0000}, {0x200E, 0x0021}, {0x200F, 0x0021},
+    {0x2010, 0x0099}, {0x2011, 0x0099}, {0x2012, 0x0099}, {0x2013, 0x0099},
+    {0x2014, 0x0099}, {0x2015, 0x0099}, {0x2016, 0x0021}, {0x2017, 0x0001},
+    {0x2018, 0x0241}, {0x2019, 0x0241}, {0x201A, 0x0241}, {0x201B, 0x0241},
+    {0x201C, 0x0569}, {0x201D, 0x0569}, {0x201E, 0x0569}, {0x201F, 0x0569},
+    {0x2020, 0x0091}, {0x2021, 0x0021}, {0x2022, 0x0571}, {0x2023, 0x0021},
+    {0x2024, 0x00C1}, {0x2025, 0x057A}, {0x2026, 0x058B}, {0x2027, 0x0021},
+    {0x2028, 0x0021}, {0x2029, 0x0021}, {0x202A, 0x0021}, {0x202B, 0x0021},
+    {0x202C, 0x0021}, {0x202D, 0x0021}, {0x202E, 0x0021}, {0x202F, 0x0001},
+    {0x2030, 0x05A2}, {0x2031, 0x05B3}, {0x2032, 0x0241}, {0x2033, 0x0569},
+    {0x2034, 0x0021}, {0x2035, 0x0021}, {0x2036, 0x0021}, {0x2037, 0x0021},
+    {0x2038, 0x0021}, {0x2039, 0x0061}, {0x203A, 0x00D1}, {0x203B, 0x0021},
+    {0x203C, 0x05CA}, {0x203D, 0x0021}, {0x203E, 0x0001}, {0x203F, 0x0021},
+    {0x2040, 0x0021}, {0x2041, 0x0021}, {0x2042, 0x0021}, {0x2043, 0x0021},
+    {0x2044, 0x00E9}, {0x2045, 0x0021}, {0x2046, 0x0021}, {0x2047, 0x05DA},
+    {0x2048, 0x05EA}, {0x2049, 0x05D2}, {0x204A, 0x0021}, {0x204B, 0x0021},
+    {0x204C, 0x0021}, {0x204D, 0x0021}, {0x204E, 0x0021}, {0x204F, 0x0021},
+    {0x2050, 0x0021}, {0x2051, 0x0021}, {0x2052, 0x0021}, {0x2053, 0x0021},
+    {0x2054, 0x0021}, {0x2055, 0x0021}, {0x2056, 0x0021}, {0x2057, 0x0021},
+    {0x2058, 0x0021}, {0x2059, 0x0021}, {0x205A, 0x0021}, {0x205B, 0x0021},
+    {0x205C, 0x0021}, {0x205D, 0x0021}, {0x205E, 0x0021}, {0x205F, 0x0001},
+    {0x2060, 0x0000}, {0x2061, 0x0021}, {0x2062, 0x0021}, {0x2063, 0x0021},
+    {0x2064, 0x0021}, {0x2065, 0x0021}, {0x2066, 0x0021}, {0x2067, 0x0021},
+    {0x2068, 0x0021}, {0x2069, 0x0021}, {0x206A, 0x0021}, {0x206B, 0x0021},
+    {0x206C, 0x0021}, {0x206D, 0x0021}, {0x206E, 0x0021}, {0x206F, 0x0021},
+};
+
+// Codepoints covered by translit_table, which holds the blocks one after
+// the other.
+static const struct {
+  utf8_code_pt first;
+  utf8_code_pt last;
+} translit_blocks[] = {{0x00A0, 0x04FF}, {0x1DC0, 0x206F}};
+
+static const struct translit_entry *translit_entry(utf8_code_pt c) {
+  size_t offset = 0;
+  for (size_t i = 0; i < sizeof(translit_blocks) / sizeof(*translit_blocks);
+       i++) {
+    if (c >= translit_blocks[i].first && c <= translit_blocks[i].last)
+      return &translit_table[offset + c - translit_blocks[i].first];
+    offset += translit_blocks[i].last - translit_blocks[i].first + 1;
+  }
+  return NULL;
+}
+
+// Length of the run of ASCII bytes at the start of s.
+static size_t ascii_run(const uint8_t *const s, size_t len) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= len; i += 16) {
+    const int mask =
+        _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i)));
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+#endif
+  while (i < len && s[i] < 0x80)
+    i++;
+  return i;
+}
+
+size_t utf8_translit_bound(size_t len, enum utf8_translit_mode mode) {
+  return mode == UTF8_TRANSLIT_ASCII ? 2 * len : len;
+}
+
+ssize_t utf8_translit(const utf8_chr *const s, size_t len,
+                      enum utf8_translit_mode mode, utf8_chr *const dest) {
+  const uint8_t *const b = (const uint8_t *)s;
+  size_t written = 0;
+
+  for (size_t i = 0; i < len;) {
+    const size_t run = ascii_run(b + i, len - i);
+    // dest may be s, so the copy can overlap.
+    memmove(dest + written, s + i, run);
+    written += run;
+    i += run;
+    if (i == len)
+      break;
+
+    utf8_code_pt c;
+    const int n = utf8_decode_next(s + i, len - i, &c);
+    if (n < 1) {
+      set_utf8_lib_error(INVALID_UTF8_SYMBOL);
+      return -1;
+    }
+    const struct translit_entry *e = translit_entry(c);
+
+    if (mode == UTF8_TRANSLIT_ASCII) {
+      if (e) {
+        const size_t length = e->ascii & 7;
+        memcpy(dest + written, translit_pool + (e->ascii >> 3), length);
+        written += length;
+      } else {
+        dest[written++] = '?';
+      }
+    } else if (!e) {
+      memmove(dest + written, s + i, n);
+      written += n;
+    } else if (e->fold != 0) {
+      written += utf8_from_codepoint(e->fold, dest + written);
+    }
+    i += n;
+  }
+  return (ssize_t)written;
+}
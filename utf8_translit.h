@@ -0,0 +1,41 @@
+#ifndef KL_UTF8_TRANSLIT_H
+#define KL_UTF8_TRANSLIT_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Output of utf8_translit.
+// UTF8_TRANSLIT_ASCII: Plain ASCII. Latin letters lose their diacritics
+//   ("é" -> "e"), ligatures and special letters are spelled out ("ß" -> "ss",
+//   "Æ" -> "AE"), Greek and Cyrillic are romanized ("Ψ" -> "Ps",
+//   "щ" -> "shch") and typographic punctuation becomes its ASCII look-alike.
+//   Combining marks are removed, everything else becomes '?'.
+// UTF8_TRANSLIT_FOLD: UTF-8 without diacritics. Latin, Greek and Cyrillic
+//   letters are replaced by their base letters ("é" -> "e", "ά" -> "α",
+//   "й" -> "и") and combining marks are removed. Everything else is kept.
+enum utf8_translit_mode {
+  UTF8_TRANSLIT_ASCII,
+  UTF8_TRANSLIT_FOLD,
+};
+
+// Number of bytes utf8_translit writes at most for len bytes of input:
+// 2 * len for UTF8_TRANSLIT_ASCII and len for UTF8_TRANSLIT_FOLD.
+size_t utf8_translit_bound(size_t len, enum utf8_translit_mode mode);
+
+// Transliterate the first len bytes of s into dest, which must have room
+// for utf8_translit_bound(len, mode) bytes. No terminating 0 is written.
+// Runs of ASCII are copied as they are. dest may be s for
+// UTF8_TRANSLIT_FOLD, since the output never gets ahead of the input.
+// Returns the number of bytes written. On invalid UTF-8, sets
+// utf8_lib_error and returns -1.
+ssize_t utf8_translit(const utf8_chr *const s, size_t len,
+                      enum utf8_translit_mode mode, utf8_chr *const dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_TRANSLIT_H
@@ -0,0 +1,94 @@
+#include "utest/utest.h"
+#include "utf8_translit.h"
+
+#include <stdlib.h>
+
+#define U8(s) utf8_reinterpret_string(s)
+
+// Transliterate s and compare the result with expected.
+static int check(const char *s, enum utf8_translit_mode mode,
+                 const char *expected) {
+  const size_t len = strlen(s);
+  utf8_chr *dest = malloc(utf8_translit_bound(len, mode) + 1);
+  const ssize_t n = utf8_translit(U8(s), len, mode, dest);
+  const int res = n >= 0 && (size_t)n == strlen(expected) &&
+                  memcmp(dest, expected, n) == 0;
+  free(dest);
+  return res;
+}
+
+UTEST(utf8_translit, ascii) {
+  ASSERT_TRUE(check("", UTF8_TRANSLIT_ASCII, ""));
+  ASSERT_TRUE(check("plain ascii", UTF8_TRANSLIT_ASCII, "plain ascii"));
+  ASSERT_TRUE(check("Caf\xC3\xA9", UTF8_TRANSLIT_ASCII, "Cafe"));
+  // Combining acute accent.
+  ASSERT_TRUE(check("Cafe\xCC\x81", UTF8_TRANSLIT_ASCII, "Cafe"));
+  ASSERT_TRUE(check("Stra\xC3\x9F" "e \xC3\x86gir", UTF8_TRANSLIT_ASCII,
+                    "Strasse AEgir"));
+  ASSERT_TRUE(check("\xC5\x81\xC3\xB3\x64\xC5\xBA", UTF8_TRANSLIT_ASCII,
+                    "Lodz"));
+  // Vietnamese "Việt Nam".
+  ASSERT_TRUE(check("Vi\xE1\xBB\x87t Nam", UTF8_TRANSLIT_ASCII, "Viet Nam"));
+  // Greek "Ψυχή" and Cyrillic "Щука", "Москва".
+  ASSERT_TRUE(check("\xCE\xA8\xCF\x85\xCF\x87\xCE\xAE", UTF8_TRANSLIT_ASCII,
+                    "Psychi"));
+  ASSERT_TRUE(check("\xD0\xA9\xD1\x83\xD0\xBA\xD0\xB0", UTF8_TRANSLIT_ASCII,
+                    "Shchuka"));
+  ASSERT_TRUE(check("\xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0",
+                    UTF8_TRANSLIT_ASCII, "Moskva"));
+  // Quotes, dash and ellipsis.
+  ASSERT_TRUE(check("\xE2\x80\x9Cok\xE2\x80\x9D \xE2\x80\x94 \xE2\x80\xA6",
+                    UTF8_TRANSLIT_ASCII, "\"ok\" - ..."));
+  // Catalan "col·la" with L middle dot, and per mille.
+  ASSERT_TRUE(check("co\xC5\x80la \xC4\xBF", UTF8_TRANSLIT_ASCII,
+                    "col.la L."));
+  ASSERT_TRUE(check("5\xE2\x80\xB0", UTF8_TRANSLIT_ASCII, "5%o"));
+  // Other scripts and emoji.
+  ASSERT_TRUE(check("a\xE4\xB8\xAD\xF0\x9F\x98\x80z", UTF8_TRANSLIT_ASCII,
+                    "a??z"));
+}
+
+UTEST(utf8_translit, fold) {
+  ASSERT_TRUE(check("Caf\xC3\xA9", UTF8_TRANSLIT_FOLD, "Cafe"));
+  ASSERT_TRUE(check("Cafe\xCC\x81", UTF8_TRANSLIT_FOLD, "Cafe"));
+  // Letters without a base letter stay.
+  ASSERT_TRUE(check("Stra\xC3\x9F" "e", UTF8_TRANSLIT_FOLD,
+                    "Stra\xC3\x9F" "e"));
+  ASSERT_TRUE(check("\xC3\x98re", UTF8_TRANSLIT_FOLD, "Ore"));
+  // "ά" -> "α", "ᾅ" -> "α", "ё" -> "е".
+  ASSERT_TRUE(check("\xCE\xAC\xE1\xBE\x85\xD1\x91", UTF8_TRANSLIT_FOLD,
+                    "\xCE\xB1\xCE\xB1\xD0\xB5"));
+  ASSERT_TRUE(check("\xE4\xB8\xAD\xF0\x9F\x98\x80", UTF8_TRANSLIT_FOLD,
+                    "\xE4\xB8\xAD\xF0\x9F\x98\x80"));
+}
+
+UTEST(utf8_translit, bounds) {
+  // Every covered codepoint, alone and after a long ASCII run, stays within
+  // the bound. Folding also works in place.
+  utf8_chr s[64], dest[128];
+  memset(s, 'x', 40);
+  for (utf8_code_pt c = 0x80; c < 0x2100; c++) {
+    if (c >= 0xD800 && c < 0xE000)
+      continue;
+    const size_t len = 40 + utf8_from_codepoint(c, s + 40);
+    ASSERT_LE((size_t)utf8_translit(s, len, UTF8_TRANSLIT_ASCII, dest),
+              utf8_translit_bound(len, UTF8_TRANSLIT_ASCII));
+    const ssize_t folded = utf8_translit(s, len, UTF8_TRANSLIT_FOLD, dest);
+    ASSERT_LE((size_t)folded, len);
+    ASSERT_EQ(utf8_translit(s, len, UTF8_TRANSLIT_FOLD, s), folded);
+    ASSERT_EQ(memcmp(s, dest, folded), 0);
+    memset(s + 40, 'x', 4);
+  }
+}
+
+UTEST(utf8_translit, errors) {
+  utf8_chr dest[16];
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_translit(U8("ab\xC3"), 3, UTF8_TRANSLIT_ASCII, dest), -1);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_translit(U8("\x80" "a"), 2, UTF8_TRANSLIT_FOLD, dest), -1);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+}
+
+UTEST_MAIN()
@@ -0,0 +1,34 @@
+#ifndef KL_UTF8_WIDTH_H
+#define KL_UTF8_WIDTH_H
+
+#include "utf8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of terminal columns a codepoint occupies, like wcwidth():
+// 0 for combining marks and other zero-width symbols, 2 for East Asian wide
+// and fullwidth symbols, 1 for everything else.
+// Returns -1 for control characters and invalid codepoints.
+int utf8_codepoint_width(utf8_code_pt c);
+
+// Number of terminal columns the first len bytes of s occupy. Control
+// characters count as 0 columns.
+// Returns SIZE_MAX and sets utf8_lib_error on invalid UTF-8.
+size_t utf8_display_width(const utf8_chr *const s, size_t len);
+
+// Number of bytes of the longest prefix of s which fits into max_width
+// columns without splitting a symbol. Zero-width symbols directly after the
+// prefix are included. If width is not NULL, the width of the prefix is
+// stored there.
+// On invalid UTF-8, sets utf8_lib_error and returns the prefix before the
+// invalid symbol.
+size_t utf8_truncate_width(const utf8_chr *const s, size_t len,
+                           size_t max_width, size_t *width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KL_UTF8_WIDTH_H
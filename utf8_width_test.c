@@ -0,0 +1,118 @@
+#include "utest/utest.h"
+#include "utf8_width.h"
+
+#define U8(s) utf8_reinterpret_string(s)
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_codepoint_width                                    //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_codepoint_width, categories) {
+  ASSERT_EQ(utf8_codepoint_width(0), 0);
+  ASSERT_EQ(utf8_codepoint_width('\n'), -1);
+  ASSERT_EQ(utf8_codepoint_width(0x7F), -1);
+  ASSERT_EQ(utf8_codepoint_width(0x85), -1);
+  ASSERT_EQ(utf8_codepoint_width('A'), 1);
+  ASSERT_EQ(utf8_codepoint_width(0xE9), 1);   // é
+  ASSERT_EQ(utf8_codepoint_width(0x03BB), 1); // λ
+  ASSERT_EQ(utf8_codepoint_width(0x0301), 0); // Combining acute accent
+  ASSERT_EQ(utf8_codepoint_width(0x200B), 0); // Zero width space
+  ASSERT_EQ(utf8_codepoint_width(0xFE0F), 0); // Variation selector 16
+  ASSERT_EQ(utf8_codepoint_width(0x4E2D), 2); // 中
+  ASSERT_EQ(utf8_codepoint_width(0xAC00), 2); // 가
+  ASSERT_EQ(utf8_codepoint_width(0x1161), 0); // Jungseong A
+  ASSERT_EQ(utf8_codepoint_width(0xD7B0), 0); // Jungseong O-Yeo
+  ASSERT_EQ(utf8_codepoint_width(0xD7FB), 0); // Jongseong Phieuph-Thieuth
+  ASSERT_EQ(utf8_codepoint_width(0xD7C7), 1); // Unassigned
+  ASSERT_EQ(utf8_codepoint_width(0xFF21), 2); // Fullwidth A
+  ASSERT_EQ(utf8_codepoint_width(0x1F600), 2);
+  ASSERT_EQ(utf8_codepoint_width(0x20000), 2);
+  ASSERT_EQ(utf8_codepoint_width(0x110000), -1);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_display_width                                      //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_display_width, ascii) {
+  const char *s = "The quick brown fox jumps over the lazy dog.";
+  ASSERT_EQ(utf8_display_width(U8(s), strlen(s)), strlen(s));
+  ASSERT_EQ(utf8_display_width(U8("a\tb\nc"), 5), (size_t)3);
+  ASSERT_EQ(utf8_display_width(U8(""), 0), (size_t)0);
+}
+
+UTEST(utf8_display_width, including_utf8) {
+  set_utf8_lib_error(0);
+  // "中文 text" => 2 + 2 + 1 + 4
+  const char *s = "\xE4\xB8\xAD\xE6\x96\x87 text";
+  ASSERT_EQ(utf8_display_width(U8(s), strlen(s)), (size_t)9);
+  // "e" followed by a combining acute accent
+  ASSERT_EQ(utf8_display_width(U8("e\xCC\x81"), 3), (size_t)1);
+  // Long ASCII run before and after a wide symbol.
+  const char *l = "0123456789abcdefghij\xE4\xB8\xAD"
+                  "0123456789abcdefghij";
+  ASSERT_EQ(utf8_display_width(U8(l), strlen(l)), (size_t)42);
+  ASSERT_EQ(get_utf8_lib_error(), 0);
+}
+
+UTEST(utf8_display_width, error_cases) {
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_display_width(U8("ab\xFF"), 3), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+
+  // Symbol cut off by the end of the buffer.
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_display_width(U8("ab\xE4\xB8\xAD"), 4), SIZE_MAX);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+//////////////////////////////////////////////////////////////////////
+// SECTION: utf8_truncate_width                                     //
+//////////////////////////////////////////////////////////////////////
+
+UTEST(utf8_truncate_width, ascii) {
+  const char *s = "0123456789abcdefghijklmnopqrstuvwxyz";
+  size_t w;
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 20, &w), (size_t)20);
+  ASSERT_EQ(w, (size_t)20);
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 100, &w), strlen(s));
+  ASSERT_EQ(w, strlen(s));
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 0, &w), (size_t)0);
+  ASSERT_EQ(w, (size_t)0);
+}
+
+UTEST(utf8_truncate_width, wide) {
+  // "a中文b"
+  const char *s = "a\xE4\xB8\xAD\xE6\x96\x87"
+                  "b";
+  size_t w;
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 2, &w), (size_t)1);
+  ASSERT_EQ(w, (size_t)1);
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 3, &w), (size_t)4);
+  ASSERT_EQ(w, (size_t)3);
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 4, &w), (size_t)4);
+  ASSERT_EQ(w, (size_t)3);
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 5, NULL), (size_t)7);
+}
+
+UTEST(utf8_truncate_width, keeps_combining_marks) {
+  // "ée" with a combining accent
+  const char *s = "e\xCC\x81"
+                  "e";
+  size_t w;
+  ASSERT_EQ(utf8_truncate_width(U8(s), strlen(s), 1, &w), (size_t)3);
+  ASSERT_EQ(w, (size_t)1);
+}
+
+UTEST(utf8_truncate_width, error_cases) {
+  set_utf8_lib_error(0);
+  ASSERT_EQ(utf8_truncate_width(U8("abc\xFF"
+                                   "d"),
+                                5, 10, NULL),
+            (size_t)3);
+  ASSERT_EQ(get_utf8_lib_error(), INVALID_UTF8_SYMBOL);
+  set_utf8_lib_error(0);
+}
+
+UTEST_MAIN()